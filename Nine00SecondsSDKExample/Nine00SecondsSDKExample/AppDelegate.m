@@ -8,6 +8,14 @@
 
 #import "AppDelegate.h"
 #import "Nine00SecondsSDK.h"
+#import "DVGUploadPolicy.h"
+#import "DVGMemoryAccounting.h"
+#import "DVGMetrics.h"
+#import "DVGCompressingLogFileManager.h"
+#import "DVGFlightRecorder.h"
+#import "CocoaLumberjack/DDASLLogger.h"
+#import "CocoaLumberjack/DDTTYLogger.h"
+#import "DVGApplicationRegistration.h"
 
 @interface AppDelegate ()
 
@@ -18,19 +26,53 @@
 
 - (BOOL)application:(UIApplication *)application didFinishLaunchingWithOptions:(NSDictionary *)launchOptions {
     // Override point for customization after application launch.
-    [NHSBroadcastManager registerAppID:@"__test_app_id" withSecret:@"Roophohro2kei2shiMe7" withCompletion:^(NHSApplication *application, NSError *error) {
+    [self setupLogging];
+
+    [[DVGApplicationRegistration sharedRegistration] registerAppID:@"__test_app_id" withSecret:@"Roophohro2kei2shiMe7" withCompletion:^(NHSApplication *application, NSError *error) {
         if (application && !error) {
-            NSLog(@"Authentication succeeded");
+            DVGLog(@"Authentication succeeded");
         } else {
-            NSLog(@"Auth Error : %@", error);
+            DVGLog(@"Auth Error : %@", error);
         }
     }];
     
-    [[NHSBroadcastManager sharedManager] scheduleSavedUploads];
+    // Saved uploads are resumed by the policy as soon as the network allows it.
+    [[DVGUploadPolicy sharedPolicy] startMonitoring];
+
+    // Registers memory counters with the metrics snapshot and starts counting memory warnings.
+    [DVGMemoryAccounting sharedAccounting];
     
     return YES;
 }
 
+- (void)setupLogging {
+    // DVGLog goes through DDLog, these take over what NSLog used to print.
+    [DDLog addLogger:[DDASLLogger sharedInstance]];
+    [DDLog addLogger:[DDTTYLogger sharedInstance]];
+
+    DVGCompressingLogFileManager *logFileManager = [[DVGCompressingLogFileManager alloc] init];
+    DDFileLogger *fileLogger = [[DDFileLogger alloc] initWithLogFileManager:logFileManager];
+    fileLogger.rollingFrequency = 60 * 60 * 24;
+    fileLogger.maximumFileSize = 1024 * 1024;
+    [DDLog addLogger:fileLogger];
+
+    // Last records of the previous run survive even if it was killed. They are saved before anything else is logged into the ring.
+    DVGFlightRecorder *flightRecorder = [DVGFlightRecorder sharedRecorder];
+    if (flightRecorder) {
+        NSArray *previousRecords = [flightRecorder decodedRecords];
+        [flightRecorder reset];
+        [DDLog addLogger:[[DVGFlightRecorderLogger alloc] initWithRecorder:flightRecorder]];
+
+        if (previousRecords.count) {
+            NSString *path = [[logFileManager logsDirectory] stringByAppendingPathComponent:@"previous-run.flightrecorder.log"];
+            [[previousRecords componentsJoinedByString:@"\n"] writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+            DVGLog(@"Saved %lu flight recorder records of the previous run to %@", (unsigned long)previousRecords.count, path);
+        }
+    }
+
+    [logFileManager compressArchivedLogFiles];
+}
+
 - (void)applicationWillResignActive:(UIApplication *)application {
     // Sent when the application is about to move from active to inactive state. This can occur for certain types of temporary interruptions (such as an incoming phone call or SMS message) or when the user quits the application and it begins the transition to the background state.
     // Use this method to pause ongoing tasks, disable timers, and throttle down OpenGL ES frame rates. Games should use this method to pause the game.
@@ -39,6 +81,8 @@
 - (void)applicationDidEnterBackground:(UIApplication *)application {
     // Use this method to release shared resources, save user data, invalidate timers, and store enough application state information to restore your application to its current state in case it is terminated later.
     // If your application supports background execution, this method is called instead of applicationWillTerminate: when the user quits.
+
+    [[DVGMetrics sharedMetrics] logSnapshot];
 }
 
 - (void)applicationWillEnterForeground:(UIApplication *)application {
@@ -0,0 +1,37 @@
+//
+//  DVGApplicationRegistration.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "Nine00SecondsSDK.h"
+
+extern NSString *const DVGApplicationRegistrationDidChangeNotification;
+
+/**
+ Wraps [NHSBroadcastManager registerAppID:withSecret:withCompletion:] so that failed registrations are retried with exponential backoff.
+ Authentication errors are not retried. DVGApplicationRegistrationDidChangeNotification is posted when the SDK gets registered or is refused.
+ */
+@interface DVGApplicationRegistration : NSObject
+
++ (instancetype)sharedRegistration;
+
+//! Application granted by server.
+@property (nonatomic, strong, readonly) NHSApplication *application;
+
+//! YES after the SDK itself has been registered during this launch.
+@property (nonatomic, readonly, getter=isRegistered) BOOL registered;
+
+//! YES from registerAppID:withSecret:withCompletion: until the SDK is registered or refused, including the waits between retries.
+@property (nonatomic, readonly, getter=isRegistering) BOOL registering;
+
+//! Completion is called with the next server response, retries after a failure only post the notification.
+//! While a registration is in progress another call only updates the credentials for the next attempt.
+- (void)registerAppID:(NSString *)appID
+           withSecret:(NSString *)secret
+       withCompletion:(void (^)(NHSApplication *application, NSError *error))completion;
+
+@end
@@ -0,0 +1,111 @@
+//
+//  DVGApplicationRegistration.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGApplicationRegistration.h"
+#import "DVGMetrics.h"
+#import "AFURLResponseSerialization.h"
+
+NSString *const DVGApplicationRegistrationDidChangeNotification = @"DVGApplicationRegistrationDidChangeNotification";
+
+static NSTimeInterval const kDVGApplicationRegistrationMinimumRetryInterval = 2.0;
+static NSTimeInterval const kDVGApplicationRegistrationMaximumRetryInterval = 120.0;
+
+@interface DVGApplicationRegistration ()
+@property (nonatomic, strong, readwrite) NHSApplication *application;
+@property (nonatomic, readwrite) BOOL registered;
+@property (nonatomic, readwrite) BOOL registering;
+@property (nonatomic, strong) NSMutableArray *completions;
+@property (nonatomic, copy) NSString *appID;
+@property (nonatomic, copy) NSString *secret;
+@property (nonatomic, assign) NSTimeInterval retryInterval;
+@property (nonatomic, strong) NSDate *registrationStartDate;
+@end
+
+@implementation DVGApplicationRegistration
+
++ (instancetype)sharedRegistration {
+    static DVGApplicationRegistration *sharedRegistration;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedRegistration = [[self alloc] init];
+    });
+
+    return sharedRegistration;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _retryInterval = kDVGApplicationRegistrationMinimumRetryInterval;
+        _completions = [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (void)registerAppID:(NSString *)appID
+           withSecret:(NSString *)secret
+       withCompletion:(void (^)(NHSApplication *application, NSError *error))completion {
+    self.appID = appID;
+    self.secret = secret;
+    if (completion) {
+        [self.completions addObject:[completion copy]];
+    }
+
+    // Pending retry picks up the new credentials, a second loop would double the requests.
+    if (self.registering) return;
+
+    self.registering = YES;
+    self.registrationStartDate = [NSDate date];
+    [self performRegistration];
+}
+
+- (void)performRegistration {
+    @weakify(self);
+    [NHSBroadcastManager registerAppID:self.appID withSecret:self.secret withCompletion:^(NHSApplication *application, NSError *error) {
+        @strongify(self);
+        if (application && !error) {
+            [[DVGMetrics sharedMetrics] setValue:-[self.registrationStartDate timeIntervalSinceNow] forMetric:@"application.registrationTime"];
+
+            self.retryInterval = kDVGApplicationRegistrationMinimumRetryInterval;
+            self.application = application;
+            self.registered = YES;
+            self.registering = NO;
+            [[NSNotificationCenter defaultCenter] postNotificationName:DVGApplicationRegistrationDidChangeNotification object:self];
+        }
+        else if ([self isAuthenticationError:error]) {
+            // Retrying with revoked credentials won't help.
+            self.application = nil;
+            self.registered = NO;
+            self.registering = NO;
+            [[NSNotificationCenter defaultCenter] postNotificationName:DVGApplicationRegistrationDidChangeNotification object:self];
+        }
+        else {
+            NSTimeInterval retryInterval = self.retryInterval;
+            self.retryInterval = MIN(retryInterval * 2, kDVGApplicationRegistrationMaximumRetryInterval);
+            DVGLog(@"Registration failed, retrying in %.0f s : %@", retryInterval, error);
+
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(retryInterval * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+                [self performRegistration];
+            });
+        }
+
+        NSArray *completions = [self.completions copy];
+        [self.completions removeAllObjects];
+        for (void (^completion)(NHSApplication *, NSError *) in completions) {
+            completion(application, error);
+        }
+    }];
+}
+
+- (BOOL)isAuthenticationError:(NSError *)error {
+    NSHTTPURLResponse *response = error.userInfo[AFNetworkingOperationFailingURLResponseErrorKey];
+    return response.statusCode == 401 || response.statusCode == 403;
+}
+
+@end
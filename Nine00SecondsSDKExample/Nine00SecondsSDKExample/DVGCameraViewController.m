@@ -8,8 +8,15 @@
 
 #import "DVGCameraViewController.h"
 #import "Nine00SecondsSDK.h"
+#import "DVGUplinkMonitor.h"
+#import "DVGUploadProgressBus.h"
+#import "DVGHLSPlaylist.h"
+#import "DVGMetrics.h"
+#import "DVGUploadPolicy.h"
+#import "DVGApplicationRegistration.h"
+#import "DVGPerformanceGovernor.h"
 
-@interface DVGCameraViewController () <NHSBroadcastManagerDelegate>
+@interface DVGCameraViewController () <NHSBroadcastManagerDelegate, DVGUplinkMonitorDelegate>
 @property (strong, nonatomic) IBOutlet UIButton *recButton;
 @property (strong, nonatomic) IBOutlet UILabel *sentLabel;
 @property (strong, nonatomic) IBOutlet UILabel *uploadClock;
@@ -18,7 +25,13 @@
 @property (nonatomic, strong) NHSCapturePreviewView *previewView;
 
 @property (nonatomic, strong) NHSStream *stream;
-@property (nonatomic, strong) NSTimer *uploadTimer;
+@property (nonatomic, strong) DVGUplinkMonitor *uplinkMonitor;
+@property (nonatomic, strong) id progressSubscriber;
+
+// Broadcast startup timings
+@property (nonatomic, strong) NSDate *broadcastRequestDate;
+@property (nonatomic, assign) BOOL didSendFirstBytes;
+@property (nonatomic, assign) BOOL waitingForRegistration;
 @end
 
 @implementation DVGCameraViewController
@@ -31,10 +44,13 @@
     
     self.broadcastManager = [NHSBroadcastManager sharedManager];
     self.broadcastManager.delegate = self;
-    self.broadcastManager.qualityPreset = NHSStreamingQualityPreset640HighBitrate;
+    [DVGUploadPolicy sharedPolicy].preferredQualityPreset = NHSStreamingQualityPreset640HighBitrate;
     self.previewView = self.broadcastManager.previewView;
     [self.view insertSubview:self.previewView belowSubview:self.recButton];
     
+    self.uplinkMonitor = [[DVGUplinkMonitor alloc] initWithProgressBus:[DVGUploadProgressBus sharedBus]];
+    self.uplinkMonitor.delegate = self;
+    
     UITapGestureRecognizer *recognizer = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(tapToFocus:)];
     [self.previewView addGestureRecognizer:recognizer];
 }
@@ -43,6 +59,7 @@
     [super viewDidAppear:animated];
     
     [self.broadcastManager startPreview];
+    [[DVGPerformanceGovernor sharedGovernor] startMonitoring];
 }
 
 - (void)viewDidLayoutSubviews {
@@ -55,8 +72,13 @@
     [[NHSBroadcastManager sharedManager] stopPreview];
     self.broadcastManager.delegate = nil;
     
-    [self.uploadTimer invalidate];
-    self.uploadTimer = nil;
+    [self.uplinkMonitor stop];
+    [[DVGUploadProgressBus sharedBus] removeSubscriber:self.progressSubscriber];
+    self.progressSubscriber = nil;
+    [[DVGPerformanceGovernor sharedGovernor] stopMonitoring];
+    
+    // Deferred broadcast must not start from an off-screen controller.
+    [self cancelWaitingForRegistration];
 }
 
 - (void)didReceiveMemoryWarning {
@@ -65,18 +87,70 @@
 }
 
 - (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
     [[NHSBroadcastManager sharedManager] stopPreview];
     
-    [self.uploadTimer invalidate];
-    self.uploadTimer = nil;
+    [[DVGUploadProgressBus sharedBus] removeSubscriber:self.progressSubscriber];
 }
 
 #pragma mark - Broadcasting actions
 
 - (void)startBroadcast {
+    self.broadcastRequestDate = [NSDate date];
+    self.didSendFirstBytes = NO;
+    
+    DVGApplicationRegistration *registration = [DVGApplicationRegistration sharedRegistration];
+    if (!registration.isRegistered) {
+        if (!registration.isRegistering) {
+            [self showRegistrationFailure];
+            return;
+        }
+        
+        // Stream can't be created before the SDK is registered, start as soon as registration completes.
+        self.waitingForRegistration = YES;
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(registrationDidChange:) name:DVGApplicationRegistrationDidChangeNotification object:nil];
+        
+        self.sentLabel.text = @"Waiting for registration...";
+        [UIView animateWithDuration:.25f animations:^{
+            self.sentLabel.alpha = 1.f;
+        }];
+        return;
+    }
+    
     [[NHSBroadcastManager sharedManager] startBroadcasting];
 }
 
+- (void)registrationDidChange:(NSNotification *)notification {
+    [self cancelWaitingForRegistration];
+    
+    if ([DVGApplicationRegistration sharedRegistration].isRegistered) {
+        // Recording starts now, not when record was tapped.
+        self.broadcastRequestDate = [NSDate date];
+        [[NHSBroadcastManager sharedManager] startBroadcasting];
+    }
+    else {
+        [self showRegistrationFailure];
+    }
+}
+
+- (void)cancelWaitingForRegistration {
+    if (!self.waitingForRegistration) return;
+    
+    self.waitingForRegistration = NO;
+    [[NSNotificationCenter defaultCenter] removeObserver:self name:DVGApplicationRegistrationDidChangeNotification object:nil];
+    [UIView animateWithDuration:.25f animations:^{
+        self.sentLabel.alpha = 0.f;
+    }];
+}
+
+- (void)showRegistrationFailure {
+    [[[UIAlertView alloc] initWithTitle:@"Can't start broadcast"
+                                message:@"The application is not registered with the server."
+                               delegate:nil
+                      cancelButtonTitle:@"OK"
+                      otherButtonTitles:nil] show];
+}
+
 - (void)stopBroadcast {
     [[NHSBroadcastManager sharedManager] stopBroadcasting];
 }
@@ -121,17 +195,43 @@
     return interfaceOrientation;
 }
 
+- (void)reportSegmentDurationsOfStream:(NHSStream *)stream {
+    NSURL *playlistURL = [self.broadcastManager broadcastingURLWithStream:stream];
+    if (!playlistURL) return;
+    
+    [DVGHLSPlaylist fetchPlaylistWithURL:playlistURL completion:^(DVGHLSPlaylist *playlist, NSError *error) {
+        DVGMetrics *metrics = [DVGMetrics sharedMetrics];
+        if (playlist.segments.count) {
+            [metrics setValue:playlist.meanSegmentDuration forMetric:@"segment.duration.mean"];
+            [metrics setValue:playlist.maxSegmentDuration forMetric:@"segment.duration.max"];
+            [metrics setValue:playlist.segmentDurationVariance forMetric:@"segment.duration.variance"];
+            
+            DVGLog(@"Stream %@ segments: %lu, mean %.2f s, max %.2f s, variance %.3f s^2 (target %.0f s)",
+                   stream.streamID, (unsigned long)playlist.segments.count, playlist.meanSegmentDuration,
+                   playlist.maxSegmentDuration, playlist.segmentDurationVariance, playlist.targetDuration);
+        }
+        else {
+            DVGLog(@"Failed to fetch playlist of stream %@ : %@", stream.streamID, error);
+        }
+        
+        // Metrics of the whole broadcast, including its segment durations.
+        [metrics logSnapshot];
+    }];
+}
+
 #pragma mark - Actions
 
 - (IBAction)tapRec:(id)sender {
-    if (self.recButton.isSelected) {
+    if (self.waitingForRegistration) {
+        [self cancelWaitingForRegistration];
+    } else if (self.recButton.isSelected) {
         [self stopBroadcast];
     } else {
         [self startBroadcast];
     }
 }
 
-- (void)uploadTimerAction {
+- (void)updateUploadClock {
     if (self.uploadClock.alpha) {
         NSTimeInterval time = [[NSDate date] timeIntervalSinceDate:self.stream.createdAt];
         
@@ -141,8 +241,17 @@
         
         self.uploadClock.text = [NSString stringWithFormat:@"%02d:%02d:%02d", minutes, seconds, milliseconds];
     }
+}
+
+- (void)uploadProgressDidChange:(int64_t)bytesSent {
+    self.sentLabel.text = [NSString stringWithFormat:@"KB sent : %.0f", bytesSent/1000.f];
     
-    self.sentLabel.text = [NSString stringWithFormat:@"KB sent : %.0f", self.broadcastManager.currentStreamBytesSent/1000.f];
+    if (!self.didSendFirstBytes && bytesSent > 0) {
+        self.didSendFirstBytes = YES;
+        NSTimeInterval timeToFirstUploadBytes = -[self.broadcastRequestDate timeIntervalSinceNow];
+        [[DVGMetrics sharedMetrics] setValue:timeToFirstUploadBytes forMetric:@"broadcast.timeToFirstUploadBytes"];
+        DVGLog(@"First upload bytes sent %.2f s after broadcast request", timeToFirstUploadBytes);
+    }
 }
 
 - (void)tapToFocus:(UITapGestureRecognizer *)recognizer {
@@ -156,14 +265,25 @@
 
 - (void)broadcastManager:(NHSBroadcastManager *)manager didStartBroadcastWithStream:(NHSStream *)stream {
     if (stream) {
-        NSLog(@"Started streaming: Stream %@", stream);
+        DVGLog(@"Started streaming: Stream %@", stream);
+        if (self.broadcastRequestDate) {
+            [[DVGMetrics sharedMetrics] setValue:-[self.broadcastRequestDate timeIntervalSinceNow] forMetric:@"broadcast.streamCreationTime"];
+        }
         self.recButton.selected = YES;
         self.stream = stream;
         
         self.sentLabel.text = @"KB sent : 0";
         
-        self.uploadTimer = [NSTimer timerWithTimeInterval:.1f target:self selector:@selector(uploadTimerAction) userInfo:nil repeats:YES];
-        [[NSRunLoop mainRunLoop] addTimer:self.uploadTimer forMode:NSDefaultRunLoopMode];
+        // Clock runs off the progress bus poll, no timer of its own.
+        @weakify(self);
+        self.progressSubscriber = [[DVGUploadProgressBus sharedBus] addTickSubscriberWithBlock:^(int64_t bytesSent, NSTimeInterval time) {
+            @strongify(self);
+            [self updateUploadClock];
+            [self uploadProgressDidChange:bytesSent];
+        }];
+        NSTimeInterval recordingStartTime = (self.broadcastRequestDate ? [self.broadcastRequestDate timeIntervalSinceReferenceDate] : -1);
+        [self.uplinkMonitor startWithQualityPreset:self.broadcastManager.qualityPreset recordingStartTime:recordingStartTime];
+        [[DVGUploadPolicy sharedPolicy] broadcastDidStart];
         
         [UIView animateWithDuration:.25f animations:^{
             self.sentLabel.alpha = 1.f;
@@ -173,24 +293,25 @@
 }
 
 - (void)broadcastManager:(NHSBroadcastManager *)manager didCreatePreviewImageForStreamWithID:(NSString *)streamID image:(UIImage *)previewImage {
-    NSLog(@"Stream %@ preview image %.0fx%.0f", streamID, previewImage.size.width, previewImage.size.height);
+    DVGLog(@"Stream %@ preview image %.0fx%.0f", streamID, previewImage.size.width, previewImage.size.height);
 }
 
 - (void)broadcastManager:(NHSBroadcastManager *)manager didUpdateLocationForStreamWithID:(NSString *)streamID withCoordinate:(CLLocationCoordinate2D)coordinate {
-    NSLog(@"Stream %@ updated it's location to %f,%f", streamID, coordinate.latitude, coordinate.longitude);
+    DVGLog(@"Stream %@ updated it's location to %f,%f", streamID, coordinate.latitude, coordinate.longitude);
 }
 
 - (void)broadcastManagerDidFailToCreateStream:(NHSBroadcastManager *)manager withError:(NSError *)error {
-    NSLog(@"Failed to create stream : %@", error);
+    DVGLog(@"Failed to create stream : %@", error);
 }
 
 - (void)broadcastManagerDidFailToStartRecording:(NHSBroadcastManager *)manager {
-    NSLog(@"Failed to start recording");
+    DVGLog(@"Failed to start recording");
 }
 
 - (void)broadcastManagerDidStopRecording:(NHSBroadcastManager *)manager {
-    NSLog(@"Stopped recording");
+    DVGLog(@"Stopped recording");
     self.recButton.selected = NO;
+    [self.uplinkMonitor recordingDidStop];
     
     [UIView animateWithDuration:.25f animations:^{
         self.uploadClock.alpha = 0.f;
@@ -198,16 +319,32 @@
 }
 
 - (void)broadcastManager:(NHSBroadcastManager *)manager didStopBroadcastOfStream:(NHSStream *)stream {
-    NSLog(@"Stopped broadcasting");
+    DVGLog(@"Stopped broadcasting");
     
-    [self.uploadTimer invalidate];
+    // Upload that kept up says nothing about the network limit, so the cap set after a slow broadcast is lifted.
+    [[DVGUploadPolicy sharedPolicy] throughputDidChange:(self.uplinkMonitor.detectedBacklog ? self.uplinkMonitor.throughput : 0)];
+    [self.uplinkMonitor stop];
+    [[DVGUploadProgressBus sharedBus] removeSubscriber:self.progressSubscriber];
+    self.progressSubscriber = nil;
+    [[DVGUploadPolicy sharedPolicy] broadcastDidStop];
     [UIView animateWithDuration:.25f animations:^{
         self.sentLabel.alpha = 0.f;
     }];
+    
+    [self reportSegmentDurationsOfStream:stream];
 }
 
 - (UIInterfaceOrientation)broadcastManagerCameraInterfaceOrientation:(NHSBroadcastManager *)manager {
     return [self cameraInterfaceOrientation];
 }
 
+#pragma mark - Uplink monitor delegate
+
+- (void)uplinkMonitorDidDetectBacklog:(DVGUplinkMonitor *)monitor {
+    DVGLog(@"Upload is %.0f s behind at %.0f kbps", monitor.backlogDuration, monitor.throughput);
+    
+    // Preset of the broadcast in progress can't be changed, the policy caps the preset of the next one.
+    [[DVGUploadPolicy sharedPolicy] throughputDidChange:monitor.throughput];
+}
+
 @end
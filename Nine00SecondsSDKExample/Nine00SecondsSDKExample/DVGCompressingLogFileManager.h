@@ -0,0 +1,42 @@
+//
+//  DVGCompressingLogFileManager.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "CocoaLumberjack/DDFileLogger.h"
+
+extern NSString *const DVGLogManifestFileNameKey;
+extern NSString *const DVGLogManifestUncompressedSizeKey;
+extern NSString *const DVGLogManifestCompressedSizeKey;
+extern NSString *const DVGLogManifestUploadedKey;
+
+typedef void (^DVGLogUploadCompletion)(BOOL success);
+typedef void (^DVGLogUploadBlock)(NSArray *filePaths, DVGLogUploadCompletion completion);
+
+/**
+ Gzips rolled log files on a background priority queue, so compression never runs on the logging queue.
+ Files are compressed in fixed size chunks and keep their creation date, so DDLogFileManagerDefault keeps ordering and deleting them as usual while the disk quota holds more history.
+ Every compressed file is recorded in a manifest with its sizes and upload state.
+ */
+@interface DVGCompressingLogFileManager : DDLogFileManagerDefault
+
+//! Called with batches of compressed files that haven't been uploaded yet. Optional.
+@property (nonatomic, copy) DVGLogUploadBlock uploadBlock;
+
+//! Number of compressed files collected before uploadBlock is called. Defaults to 5.
+@property (nonatomic, assign) NSUInteger uploadBatchSize;
+
+//! Manifest entries, dictionaries with DVGLogManifest...Key keys.
+- (NSArray *)manifest;
+
+//! Compresses archived files left uncompressed, e.g. when the app was killed mid-compression.
+- (void)compressArchivedLogFiles;
+
+//! Passes all files not uploaded yet to uploadBlock regardless of batch size.
+- (void)uploadCompressedLogFiles;
+
+@end
@@ -0,0 +1,241 @@
+//
+//  DVGCompressingLogFileManager.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGCompressingLogFileManager.h"
+#import "DVGMetrics.h"
+#import <zlib.h>
+
+NSString *const DVGLogManifestFileNameKey = @"fileName";
+NSString *const DVGLogManifestUncompressedSizeKey = @"uncompressedSize";
+NSString *const DVGLogManifestCompressedSizeKey = @"compressedSize";
+NSString *const DVGLogManifestUploadedKey = @"uploaded";
+
+static NSString *const kDVGCompressedLogFileExtension = @"gz";
+static NSString *const kDVGLogManifestFileName = @"manifest.plist";
+static NSString *const kDVGLogCompressionDirectoryName = @"Compressing";
+static NSUInteger const kDVGLogCompressionChunkSize = 64 * 1024;
+
+@interface DVGCompressingLogFileManager ()
+@property (nonatomic, strong) dispatch_queue_t compressionQueue;
+@property (nonatomic, strong) NSMutableArray *mutableManifest;
+@property (nonatomic, assign) BOOL uploading;
+@end
+
+@implementation DVGCompressingLogFileManager
+
+- (instancetype)initWithLogsDirectory:(NSString *)logsDirectory {
+    self = [super initWithLogsDirectory:logsDirectory];
+    if (self) {
+        _uploadBatchSize = 5;
+        _compressionQueue = dispatch_queue_create("com.denivip.logcompression", DISPATCH_QUEUE_SERIAL);
+        dispatch_set_target_queue(_compressionQueue, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0));
+
+        _mutableManifest = [NSMutableArray arrayWithContentsOfFile:[self manifestPath]] ?: [NSMutableArray array];
+    }
+
+    return self;
+}
+
+- (NSString *)manifestPath {
+    return [[self logsDirectory] stringByAppendingPathComponent:kDVGLogManifestFileName];
+}
+
+- (NSArray *)manifest {
+    __block NSArray *manifest;
+    dispatch_sync(self.compressionQueue, ^{
+        manifest = [self.mutableManifest copy];
+    });
+
+    return manifest;
+}
+
+#pragma mark - DDLogFileManager
+
+- (BOOL)isLogFile:(NSString *)fileName {
+    if ([[fileName pathExtension] isEqualToString:kDVGCompressedLogFileExtension]) {
+        fileName = [fileName stringByDeletingPathExtension];
+    }
+
+    return [super isLogFile:fileName];
+}
+
+// Optional DDLogFileManager methods, DDLogFileManagerDefault doesn't implement them.
+
+- (void)didRollAndArchiveLogFile:(NSString *)logFilePath {
+    // Called on the logging queue.
+    dispatch_async(self.compressionQueue, ^{
+        [self compressLogFileAtPath:logFilePath];
+    });
+}
+
+- (void)didArchiveLogFile:(NSString *)logFilePath {
+    dispatch_async(self.compressionQueue, ^{
+        [self compressLogFileAtPath:logFilePath];
+    });
+}
+
+#pragma mark - Compression
+
+- (NSString *)compressionDirectory {
+    return [[self logsDirectory] stringByAppendingPathComponent:kDVGLogCompressionDirectoryName];
+}
+
+- (void)compressArchivedLogFiles {
+    dispatch_async(self.compressionQueue, ^{
+        // Leftovers of a compression interrupted by process death, the original files are still in place.
+        [[NSFileManager defaultManager] removeItemAtPath:[self compressionDirectory] error:nil];
+
+        for (DDLogFileInfo *info in [self unsortedLogFileInfos]) {
+            if (info.isArchived && ![[info.filePath pathExtension] isEqualToString:kDVGCompressedLogFileExtension]) {
+                [self compressLogFileAtPath:info.filePath];
+            }
+        }
+    });
+}
+
+- (void)compressLogFileAtPath:(NSString *)logFilePath {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSDictionary *attributes = [fileManager attributesOfItemAtPath:logFilePath error:nil];
+    if (!attributes) return;
+
+    // Compressed file is completed and archived outside of the logs directory, so DDFileLogger never sees a partial
+    // file it could pick as the current log file. Rename within the same volume makes it appear at once.
+    NSString *compressionDirectory = [self compressionDirectory];
+    [fileManager createDirectoryAtPath:compressionDirectory withIntermediateDirectories:YES attributes:nil error:nil];
+
+    NSString *fileName = [[logFilePath lastPathComponent] stringByAppendingPathExtension:kDVGCompressedLogFileExtension];
+    NSString *temporaryFilePath = [compressionDirectory stringByAppendingPathComponent:fileName];
+    NSDate *startDate = [NSDate date];
+
+    if (![self gzipFileAtPath:logFilePath toPath:temporaryFilePath]) {
+        DVGLog(@"Failed to compress log file %@", logFilePath);
+        [fileManager removeItemAtPath:temporaryFilePath error:nil];
+        return;
+    }
+
+    // Keeps the file in its place when DDLogFileManagerDefault sorts log files by creation date.
+    [fileManager setAttributes:@{ NSFileCreationDate : attributes[NSFileCreationDate] ?: startDate } ofItemAtPath:temporaryFilePath error:nil];
+
+    // On the simulator archived flag is a part of the file name, so the name is known only after archiving.
+    DDLogFileInfo *compressedFileInfo = [[DDLogFileInfo alloc] initWithFilePath:temporaryFilePath];
+    compressedFileInfo.isArchived = YES;
+
+    NSString *compressedFilePath = [[self logsDirectory] stringByAppendingPathComponent:compressedFileInfo.fileName];
+    if (rename([compressedFileInfo.filePath fileSystemRepresentation], [compressedFilePath fileSystemRepresentation]) != 0) {
+        DVGLog(@"Failed to move compressed log file %@ : %s", compressedFilePath, strerror(errno));
+        [fileManager removeItemAtPath:compressedFileInfo.filePath error:nil];
+        return;
+    }
+    [fileManager removeItemAtPath:logFilePath error:nil];
+
+    unsigned long long uncompressedSize = [attributes fileSize];
+    unsigned long long compressedSize = [[fileManager attributesOfItemAtPath:compressedFilePath error:nil] fileSize];
+    NSTimeInterval duration = MAX(-[startDate timeIntervalSinceNow], 0.001);
+
+    DVGMetrics *metrics = [DVGMetrics sharedMetrics];
+    [metrics addValue:uncompressedSize toMetric:@"logs.uncompressedBytes"];
+    [metrics addValue:compressedSize toMetric:@"logs.compressedBytes"];
+    [metrics setValue:uncompressedSize / 1024.0 / duration forMetric:@"logs.compressionThroughput"];
+
+    [self.mutableManifest addObject:@{ DVGLogManifestFileNameKey : [compressedFilePath lastPathComponent],
+                                       DVGLogManifestUncompressedSizeKey : @(uncompressedSize),
+                                       DVGLogManifestCompressedSizeKey : @(compressedSize),
+                                       DVGLogManifestUploadedKey : @NO }];
+    [self saveManifest];
+
+    [self uploadPendingLogFilesWithMinimumCount:self.uploadBatchSize];
+}
+
+- (BOOL)gzipFileAtPath:(NSString *)sourcePath toPath:(NSString *)destinationPath {
+    FILE *source = fopen([sourcePath fileSystemRepresentation], "rb");
+    if (!source) return NO;
+
+    gzFile destination = gzopen([destinationPath fileSystemRepresentation], "wb6");
+    if (!destination) {
+        fclose(source);
+        return NO;
+    }
+
+    BOOL success = YES;
+    char *buffer = malloc(kDVGLogCompressionChunkSize);
+    size_t length;
+    while ((length = fread(buffer, 1, kDVGLogCompressionChunkSize, source)) > 0) {
+        if (gzwrite(destination, buffer, (unsigned)length) != (int)length) {
+            success = NO;
+            break;
+        }
+    }
+
+    if (ferror(source)) success = NO;
+
+    free(buffer);
+    fclose(source);
+    if (gzclose(destination) != Z_OK) success = NO;
+
+    return success;
+}
+
+#pragma mark - Manifest
+
+- (void)saveManifest {
+    // Entries of files deleted by the disk quota are dropped.
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSIndexSet *deletedIndexes = [self.mutableManifest indexesOfObjectsPassingTest:^BOOL(NSDictionary *entry, NSUInteger idx, BOOL *stop) {
+        NSString *filePath = [[self logsDirectory] stringByAppendingPathComponent:entry[DVGLogManifestFileNameKey]];
+        return ![fileManager fileExistsAtPath:filePath];
+    }];
+    [self.mutableManifest removeObjectsAtIndexes:deletedIndexes];
+
+    [self.mutableManifest writeToFile:[self manifestPath] atomically:YES];
+}
+
+#pragma mark - Upload
+
+- (void)uploadCompressedLogFiles {
+    dispatch_async(self.compressionQueue, ^{
+        [self uploadPendingLogFilesWithMinimumCount:1];
+    });
+}
+
+- (void)uploadPendingLogFilesWithMinimumCount:(NSUInteger)minimumCount {
+    DVGLogUploadBlock uploadBlock = self.uploadBlock;
+    if (!uploadBlock || self.uploading) return;
+
+    NSMutableArray *fileNames = [NSMutableArray array];
+    for (NSDictionary *entry in self.mutableManifest) {
+        if (![entry[DVGLogManifestUploadedKey] boolValue]) {
+            [fileNames addObject:entry[DVGLogManifestFileNameKey]];
+        }
+    }
+    if (fileNames.count == 0 || fileNames.count < minimumCount) return;
+
+    NSMutableArray *filePaths = [NSMutableArray arrayWithCapacity:fileNames.count];
+    for (NSString *fileName in fileNames) {
+        [filePaths addObject:[[self logsDirectory] stringByAppendingPathComponent:fileName]];
+    }
+
+    self.uploading = YES;
+    uploadBlock(filePaths, ^(BOOL success) {
+        dispatch_async(self.compressionQueue, ^{
+            self.uploading = NO;
+            if (!success) return;
+
+            for (NSUInteger i = 0; i < self.mutableManifest.count; i++) {
+                NSDictionary *entry = self.mutableManifest[i];
+                if ([fileNames containsObject:entry[DVGLogManifestFileNameKey]]) {
+                    NSMutableDictionary *uploadedEntry = [entry mutableCopy];
+                    uploadedEntry[DVGLogManifestUploadedKey] = @YES;
+                    self.mutableManifest[i] = uploadedEntry;
+                }
+            }
+            [self saveManifest];
+        });
+    });
+}
+
+@end
@@ -8,32 +8,45 @@
 
 #import "DVGFeatureListTableViewController.h"
 #import "DVGStreamsMapViewController.h"
+#import "DVGLocationService.h"
 @import CoreLocation;
 
-@interface DVGFeatureListTableViewController () <CLLocationManagerDelegate>
-@property (nonatomic, strong) CLLocationManager *locationManager;
+@interface DVGFeatureListTableViewController ()
 @property (nonatomic, assign) CLLocationCoordinate2D userLocation;
+@property (nonatomic, assign) BOOL updatingLocation;
 @end
 
 @implementation DVGFeatureListTableViewController
 
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
 - (void)loadView {
     [super loadView];
     
-    if ([CLLocationManager locationServicesEnabled]) {
-        if ([CLLocationManager authorizationStatus] == kCLAuthorizationStatusNotDetermined &&
-            [CLLocationManager instancesRespondToSelector:@selector(requestWhenInUseAuthorization)]) {
-            self.locationManager = [[CLLocationManager alloc] init];
-            self.locationManager.delegate = self;
-            [self.locationManager requestWhenInUseAuthorization];
-        } else {
-            self.locationManager = [[CLLocationManager alloc] init];
-            self.locationManager.delegate = self;
-            [self.locationManager startUpdatingLocation];
-        }
+    [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(locationServiceDidUpdateLocation:) name:DVGLocationServiceDidUpdateLocationNotification object:nil];
+}
+
+- (void)viewWillAppear:(BOOL)animated {
+    [super viewWillAppear:animated];
+    
+    // Only the initial map region depends on it, one fix is enough.
+    DVGLocationService *locationService = [DVGLocationService sharedService];
+    if (locationService.location) {
+        self.userLocation = locationService.location.coordinate;
+    }
+    else {
+        [self startUpdatingLocation];
     }
 }
 
+- (void)viewWillDisappear:(BOOL)animated {
+    [super viewWillDisappear:animated];
+    
+    [self stopUpdatingLocation];
+}
+
 - (void)viewDidLoad {
     [super viewDidLoad];
     
@@ -66,23 +79,26 @@
     return 3;
 }
 
-#pragma mark - Location manager delegate
+#pragma mark - Location service
 
-- (void)locationManager:(CLLocationManager *)manager didUpdateLocations:(NSArray *)locations {
-    if (locations.count) {
-        CLLocation *location = [locations firstObject];
-        self.userLocation = location.coordinate;
-        
-        [manager stopUpdatingLocation];
-    }
+- (void)startUpdatingLocation {
+    if (self.updatingLocation) return;
+    
+    self.updatingLocation = YES;
+    [[DVGLocationService sharedService] start];
 }
 
-- (void)locationManager:(CLLocationManager *)manager didChangeAuthorizationStatus:(CLAuthorizationStatus)status {
-    if (status == kCLAuthorizationStatusAuthorized ||
-        status == kCLAuthorizationStatusAuthorizedAlways ||
-        status == kCLAuthorizationStatusAuthorizedWhenInUse) {
-        [manager startUpdatingLocation];
-    }
+- (void)stopUpdatingLocation {
+    if (!self.updatingLocation) return;
+    
+    self.updatingLocation = NO;
+    [[DVGLocationService sharedService] stop];
+}
+
+- (void)locationServiceDidUpdateLocation:(NSNotification *)notification {
+    DVGLocationService *locationService = notification.object;
+    self.userLocation = locationService.location.coordinate;
+    [self stopUpdatingLocation];
 }
 
 @end
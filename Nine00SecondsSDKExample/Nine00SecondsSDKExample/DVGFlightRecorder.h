@@ -0,0 +1,52 @@
+//
+//  DVGFlightRecorder.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "CocoaLumberjack/DDLog.h"
+
+//! DDLog context of DVGLog messages. They are in the flight recorder already, DVGFlightRecorderLogger skips them.
+FOUNDATION_EXPORT int const DVGLogContext;
+
+/**
+ Records the message into the shared flight recorder on the calling thread, then passes it to DDLog. Use it instead of NSLog for app diagnostics, so the last ones survive a crash.
+ */
+FOUNDATION_EXPORT void DVGLog(NSString *format, ...) NS_FORMAT_FUNCTION(1,2);
+
+/**
+ Ring of the most recent log records in a memory-mapped file. Pages of a shared mapping belong to the kernel, so records written before the process is killed are still in the file on next launch.
+ Writers claim slots with an atomic counter and never lock. A record is valid once its sequence number is written, torn records are skipped when decoding.
+ */
+@interface DVGFlightRecorder : NSObject
+
+//! Ring file in Caches directory.
++ (instancetype)sharedRecorder;
+
+//! Opens existing ring without clearing it. Returns nil if the file can't be mapped.
+- (instancetype)initWithPath:(NSString *)path slotCount:(NSUInteger)slotCount;
+
+@property (nonatomic, copy, readonly) NSString *path;
+
+//! Writes a record on the calling thread, message longer than slot is truncated. Level is a DDLog flag.
+- (void)recordMessage:(const char *)message length:(size_t)length level:(int)level;
+
+//! Records currently in the ring, oldest first, as "timestamp level message" lines.
+- (NSArray *)decodedRecords;
+
+//! Clears the ring, e.g. after records of the previous session are saved.
+- (void)reset;
+
+@end
+
+/**
+ Forwards DDLog messages to the flight recorder, mainly those of the SDK. They reach it from the logging queue, so the last ones may be lost with the process, unlike DVGLog messages.
+ */
+@interface DVGFlightRecorderLogger : DDAbstractLogger <DDLogger>
+
+- (instancetype)initWithRecorder:(DVGFlightRecorder *)recorder;
+
+@end
@@ -0,0 +1,204 @@
+//
+//  DVGFlightRecorder.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGFlightRecorder.h"
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+static uint32_t const kDVGFlightRecorderMagic = 0x44464c52; // "DFLR"
+static uint32_t const kDVGFlightRecorderVersion = 1;
+static NSUInteger const kDVGFlightRecorderDefaultSlotCount = 1024;
+
+int const DVGLogContext = 0x44564c47; // "DVLG"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t recordSize;
+    _Atomic int64_t lastSequence;
+} DVGFlightRecorderHeader;
+
+typedef struct {
+    _Atomic int64_t sequence;
+    double timestamp;
+    int32_t level;
+    uint32_t length;
+    char message[232];
+} DVGFlightRecorderRecord;
+
+@interface DVGFlightRecorder ()
+@property (nonatomic, copy, readwrite) NSString *path;
+@property (nonatomic, assign) NSUInteger slotCount;
+@property (nonatomic, assign) size_t mappingSize;
+@property (nonatomic, assign) DVGFlightRecorderHeader *header;
+@property (nonatomic, assign) DVGFlightRecorderRecord *records;
+@end
+
+@implementation DVGFlightRecorder
+
++ (instancetype)sharedRecorder {
+    static DVGFlightRecorder *sharedRecorder;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSString *cachesDirectory = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+        NSString *path = [cachesDirectory stringByAppendingPathComponent:@"FlightRecorder.ring"];
+        sharedRecorder = [[self alloc] initWithPath:path slotCount:kDVGFlightRecorderDefaultSlotCount];
+    });
+
+    return sharedRecorder;
+}
+
+- (instancetype)initWithPath:(NSString *)path slotCount:(NSUInteger)slotCount {
+    self = [super init];
+    if (self) {
+        _path = [path copy];
+        _slotCount = slotCount;
+        _mappingSize = sizeof(DVGFlightRecorderHeader) + slotCount * sizeof(DVGFlightRecorderRecord);
+
+        int fd = open([path fileSystemRepresentation], O_RDWR | O_CREAT, 0644);
+        if (fd < 0) return nil;
+
+        void *mapping = MAP_FAILED;
+        if (ftruncate(fd, (off_t)_mappingSize) == 0) {
+            mapping = mmap(NULL, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+            // Not DVGLog, it would reenter the creation of the shared recorder.
+            NSLog(@"Failed to map flight recorder file %@ : %s", path, strerror(errno));
+            return nil;
+        }
+
+        _header = mapping;
+        _records = (DVGFlightRecorderRecord *)((char *)mapping + sizeof(DVGFlightRecorderHeader));
+
+        if (![self hasValidHeader]) {
+            [self reset];
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    if (_header) {
+        munmap(_header, _mappingSize);
+    }
+}
+
+- (BOOL)hasValidHeader {
+    return (self.header->magic == kDVGFlightRecorderMagic &&
+            self.header->version == kDVGFlightRecorderVersion &&
+            self.header->slotCount == self.slotCount &&
+            self.header->recordSize == sizeof(DVGFlightRecorderRecord));
+}
+
+- (void)reset {
+    memset(self.header, 0, self.mappingSize);
+    self.header->magic = kDVGFlightRecorderMagic;
+    self.header->version = kDVGFlightRecorderVersion;
+    self.header->slotCount = (uint32_t)self.slotCount;
+    self.header->recordSize = sizeof(DVGFlightRecorderRecord);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+#pragma mark - Recording
+
+- (void)recordMessage:(const char *)message length:(size_t)length level:(int)level {
+    int64_t sequence = atomic_fetch_add_explicit(&_header->lastSequence, 1, memory_order_relaxed) + 1;
+    DVGFlightRecorderRecord *record = &_records[(sequence - 1) % _slotCount];
+
+    // Invalidate the slot first, so a record interrupted by process death is not decoded as a mix of two.
+    atomic_store_explicit(&record->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    record->timestamp = CFAbsoluteTimeGetCurrent();
+    record->level = level;
+    record->length = (uint32_t)MIN(length, sizeof(record->message));
+    memcpy(record->message, message, record->length);
+
+    atomic_store_explicit(&record->sequence, sequence, memory_order_release);
+}
+
+#pragma mark - Decoding
+
+- (NSArray *)decodedRecords {
+    NSMutableArray *records = [NSMutableArray arrayWithCapacity:self.slotCount];
+    for (NSUInteger i = 0; i < self.slotCount; i++) {
+        DVGFlightRecorderRecord *record = &self.records[i];
+        int64_t sequence = atomic_load_explicit(&record->sequence, memory_order_acquire);
+        if (sequence <= 0 || record->length > sizeof(record->message)) continue;
+
+        NSString *message = [[NSString alloc] initWithBytes:record->message length:record->length encoding:NSUTF8StringEncoding];
+        [records addObject:@{ @"sequence" : @(sequence),
+                              @"timestamp" : [NSDate dateWithTimeIntervalSinceReferenceDate:record->timestamp],
+                              @"level" : @(record->level),
+                              // Truncation may have cut a multibyte character.
+                              @"message" : message ?: @"<invalid UTF-8>" }];
+    }
+
+    [records sortUsingDescriptors:@[ [NSSortDescriptor sortDescriptorWithKey:@"sequence" ascending:YES] ]];
+
+    NSMutableArray *lines = [NSMutableArray arrayWithCapacity:records.count];
+    for (NSDictionary *record in records) {
+        [lines addObject:[NSString stringWithFormat:@"%@ %@ %@", record[@"timestamp"], record[@"level"], record[@"message"]]];
+    }
+
+    return lines;
+}
+
+@end
+
+@interface DVGFlightRecorderLogger ()
+@property (nonatomic, strong) DVGFlightRecorder *recorder;
+@end
+
+@implementation DVGFlightRecorderLogger
+
+- (instancetype)initWithRecorder:(DVGFlightRecorder *)recorder {
+    self = [super init];
+    if (self) {
+        _recorder = recorder;
+    }
+
+    return self;
+}
+
+- (void)logMessage:(DDLogMessage *)logMessage {
+    if (logMessage->logContext == DVGLogContext) return;
+
+    NSString *message = formatter ? [formatter formatLogMessage:logMessage] : logMessage->logMsg;
+    const char *utf8 = [message UTF8String];
+    if (!utf8) return;
+
+    [self.recorder recordMessage:utf8 length:strlen(utf8) level:logMessage->logFlag];
+}
+
+@end
+
+#pragma mark - Logging
+
+void DVGLog(NSString *format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    NSString *message = [[NSString alloc] initWithFormat:format arguments:arguments];
+    va_end(arguments);
+
+    const char *utf8 = [message UTF8String];
+    if (utf8) {
+        [[DVGFlightRecorder sharedRecorder] recordMessage:utf8 length:strlen(utf8) level:LOG_FLAG_INFO];
+    }
+
+    // Console and file loggers.
+    [DDLog log:LOG_ASYNC_INFO level:LOG_LEVEL_INFO flag:LOG_FLAG_INFO context:DVGLogContext
+          file:__FILE__ function:__FUNCTION__ line:__LINE__ tag:nil format:@"%@", message];
+}
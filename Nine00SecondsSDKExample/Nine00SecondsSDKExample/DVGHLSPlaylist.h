@@ -0,0 +1,52 @@
+//
+//  DVGHLSPlaylist.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class AFHTTPRequestOperation;
+
+extern NSString *const DVGHLSPlaylistErrorDomain;
+
+@interface DVGHLSSegment : NSObject
+
+@property (nonatomic, assign) NSInteger sequenceNumber;
+@property (nonatomic, assign) NSTimeInterval duration;
+@property (nonatomic, copy) NSString *URI;
+
+@end
+
+/**
+ Minimal parser of HLS media playlists as served for broadcasts. Used to check how close the produced segments are to the target duration.
+ */
+@interface DVGHLSPlaylist : NSObject
+
+@property (nonatomic, readonly) NSTimeInterval targetDuration;
+@property (nonatomic, readonly) NSInteger mediaSequence;
+@property (nonatomic, readonly, getter=isEndList) BOOL endList;
+
+//! Array of DVGHLSSegment objects in playlist order.
+@property (nonatomic, copy, readonly) NSArray *segments;
+
+//! URIs of variant streams if this is a master playlist.
+@property (nonatomic, copy, readonly) NSArray *variantURIs;
+
+@property (nonatomic, readonly) NSTimeInterval totalDuration;
+@property (nonatomic, readonly) NSTimeInterval meanSegmentDuration;
+@property (nonatomic, readonly) NSTimeInterval maxSegmentDuration;
+//! Population variance of segment durations in seconds squared.
+@property (nonatomic, readonly) double segmentDurationVariance;
+
++ (instancetype)playlistWithString:(NSString *)string error:(NSError **)error;
+
+/**
+ Fetches and parses a playlist. Master playlists are followed to their first variant, a variant that is a master playlist again fails with an error.
+ */
++ (AFHTTPRequestOperation *)fetchPlaylistWithURL:(NSURL *)URL
+                                      completion:(void (^)(DVGHLSPlaylist *playlist, NSError *error))completion;
+
+@end
@@ -0,0 +1,154 @@
+//
+//  DVGHLSPlaylist.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGHLSPlaylist.h"
+#import "AFHTTPRequestOperation.h"
+
+NSString *const DVGHLSPlaylistErrorDomain = @"DVGHLSPlaylistErrorDomain";
+
+@implementation DVGHLSSegment
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; #%ld %.3fs %@>", [self class], self, (long)self.sequenceNumber, self.duration, self.URI];
+}
+
+@end
+
+@interface DVGHLSPlaylist ()
+@property (nonatomic, readwrite) NSTimeInterval targetDuration;
+@property (nonatomic, readwrite) NSInteger mediaSequence;
+@property (nonatomic, readwrite) BOOL endList;
+@property (nonatomic, copy, readwrite) NSArray *segments;
+@property (nonatomic, copy, readwrite) NSArray *variantURIs;
+@end
+
+@implementation DVGHLSPlaylist
+
++ (instancetype)playlistWithString:(NSString *)string error:(NSError **)error {
+    NSArray *lines = [string componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]];
+    NSCharacterSet *whitespace = [NSCharacterSet whitespaceCharacterSet];
+
+    NSUInteger firstLineIndex = [lines indexOfObjectPassingTest:^BOOL(NSString *line, NSUInteger idx, BOOL *stop) {
+        return [line stringByTrimmingCharactersInSet:whitespace].length > 0;
+    }];
+    if (firstLineIndex == NSNotFound || ![[lines[firstLineIndex] stringByTrimmingCharactersInSet:whitespace] isEqualToString:@"#EXTM3U"]) {
+        if (error) {
+            *error = [NSError errorWithDomain:DVGHLSPlaylistErrorDomain code:1 userInfo:@{ NSLocalizedDescriptionKey : @"Not an M3U8 playlist" }];
+        }
+        return nil;
+    }
+
+    DVGHLSPlaylist *playlist = [[self alloc] init];
+    NSMutableArray *segments = [NSMutableArray array];
+    NSMutableArray *variantURIs = [NSMutableArray array];
+
+    DVGHLSSegment *pendingSegment;
+    BOOL pendingVariant = NO;
+    for (NSString *rawLine in lines) {
+        NSString *line = [rawLine stringByTrimmingCharactersInSet:whitespace];
+        if (line.length == 0) {
+            continue;
+        }
+
+        if ([line hasPrefix:@"#EXT-X-TARGETDURATION:"]) {
+            playlist.targetDuration = [[line substringFromIndex:@"#EXT-X-TARGETDURATION:".length] doubleValue];
+        }
+        else if ([line hasPrefix:@"#EXT-X-MEDIA-SEQUENCE:"]) {
+            playlist.mediaSequence = [[line substringFromIndex:@"#EXT-X-MEDIA-SEQUENCE:".length] integerValue];
+        }
+        else if ([line hasPrefix:@"#EXTINF:"]) {
+            pendingSegment = [[DVGHLSSegment alloc] init];
+            // Duration may be followed by a comma and an optional title.
+            pendingSegment.duration = [[line substringFromIndex:@"#EXTINF:".length] doubleValue];
+        }
+        else if ([line hasPrefix:@"#EXT-X-STREAM-INF:"]) {
+            pendingVariant = YES;
+        }
+        else if ([line isEqualToString:@"#EXT-X-ENDLIST"]) {
+            playlist.endList = YES;
+        }
+        else if (![line hasPrefix:@"#"]) {
+            if (pendingSegment) {
+                pendingSegment.URI = line;
+                pendingSegment.sequenceNumber = playlist.mediaSequence + segments.count;
+                [segments addObject:pendingSegment];
+                pendingSegment = nil;
+            }
+            else if (pendingVariant) {
+                [variantURIs addObject:line];
+                pendingVariant = NO;
+            }
+        }
+    }
+
+    playlist.segments = segments;
+    playlist.variantURIs = variantURIs;
+
+    return playlist;
+}
+
++ (AFHTTPRequestOperation *)fetchPlaylistWithURL:(NSURL *)URL
+                                      completion:(void (^)(DVGHLSPlaylist *playlist, NSError *error))completion {
+    return [self fetchPlaylistWithURL:URL followsVariants:YES completion:completion];
+}
+
++ (AFHTTPRequestOperation *)fetchPlaylistWithURL:(NSURL *)URL
+                                 followsVariants:(BOOL)followsVariants
+                                      completion:(void (^)(DVGHLSPlaylist *playlist, NSError *error))completion {
+    AFHTTPRequestOperation *operation = [[AFHTTPRequestOperation alloc] initWithRequest:[NSURLRequest requestWithURL:URL]];
+    [operation setCompletionBlockWithSuccess:^(AFHTTPRequestOperation *operation, id responseObject) {
+        NSError *error;
+        DVGHLSPlaylist *playlist = [self playlistWithString:operation.responseString error:&error];
+        if (playlist.variantURIs.count && !playlist.segments.count) {
+            if (!followsVariants) {
+                // Variant of a master playlist is a master playlist again, don't follow the chain.
+                if (completion) completion(nil, [NSError errorWithDomain:DVGHLSPlaylistErrorDomain code:2 userInfo:@{ NSLocalizedDescriptionKey : @"Nested master playlist" }]);
+                return;
+            }
+
+            NSURL *variantURL = [NSURL URLWithString:playlist.variantURIs[0] relativeToURL:URL];
+            [self fetchPlaylistWithURL:variantURL followsVariants:NO completion:completion];
+            return;
+        }
+
+        if (completion) completion(playlist, error);
+    } failure:^(AFHTTPRequestOperation *operation, NSError *error) {
+        if (completion) completion(nil, error);
+    }];
+    [operation start];
+
+    return operation;
+}
+
+#pragma mark - Segment duration statistics
+
+- (NSTimeInterval)totalDuration {
+    return [[self.segments valueForKeyPath:@"@sum.duration"] doubleValue];
+}
+
+- (NSTimeInterval)meanSegmentDuration {
+    return self.segments.count ? self.totalDuration / self.segments.count : 0;
+}
+
+- (NSTimeInterval)maxSegmentDuration {
+    return [[self.segments valueForKeyPath:@"@max.duration"] doubleValue];
+}
+
+- (double)segmentDurationVariance {
+    if (self.segments.count == 0) return 0;
+
+    NSTimeInterval mean = self.meanSegmentDuration;
+    double sumOfSquares = 0;
+    for (DVGHLSSegment *segment in self.segments) {
+        sumOfSquares += (segment.duration - mean) * (segment.duration - mean);
+    }
+
+    return sumOfSquares / self.segments.count;
+}
+
+@end
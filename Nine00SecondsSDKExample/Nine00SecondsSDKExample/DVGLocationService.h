@@ -0,0 +1,49 @@
+//
+//  DVGLocationService.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+@import CoreLocation;
+
+extern NSString *const DVGLocationServiceDidUpdateLocationNotification;
+extern NSString *const DVGLocationServiceDidChangeAuthorizationNotification;
+
+//! Side of the grid cell locations are snapped to. Matches the accuracy the SDK reports viewer coordinates with.
+extern CLLocationDistance const kDVGLocationServiceQuantizationDistance;
+
+/**
+ Single location manager shared by all screens. Raw fixes are snapped to a 100 m grid and published only when they moved to another grid cell and minimumUpdateInterval passed since the previous published location.
+ A fix in another cell arriving sooner is held back and published once the interval has passed, unless a newer fix replaces it first.
+ Updates run while at least one consumer has called start and not yet stop.
+ */
+@interface DVGLocationService : NSObject
+
++ (instancetype)sharedService;
+
+//! Defaults to 30 seconds.
+@property (nonatomic, assign) NSTimeInterval minimumUpdateInterval;
+
+//! Last published, quantized location.
+@property (nonatomic, strong, readonly) CLLocation *location;
+
+//! Quantized fix in another cell waiting for minimumUpdateInterval to pass.
+@property (nonatomic, strong, readonly) CLLocation *pendingLocation;
+
+@property (nonatomic, readonly, getter=isAuthorized) BOOL authorized;
+
+//! Requests authorization if it wasn't determined yet and starts updates once authorized. Calls must be balanced with stop.
+- (void)start;
+//! Updates stop when the last consumer calls it.
+- (void)stop;
+
+//! Feeds a raw fix through quantization and hysteresis. Returns YES if it was published right away.
+- (BOOL)processLocation:(CLLocation *)location;
+
++ (CLLocationCoordinate2D)quantizedCoordinate:(CLLocationCoordinate2D)coordinate;
++ (BOOL)coordinate:(CLLocationCoordinate2D)coordinate isInSameCellAsCoordinate:(CLLocationCoordinate2D)otherCoordinate;
+
+@end
@@ -0,0 +1,198 @@
+//
+//  DVGLocationService.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGLocationService.h"
+#import "DVGMetrics.h"
+
+NSString *const DVGLocationServiceDidUpdateLocationNotification = @"DVGLocationServiceDidUpdateLocationNotification";
+NSString *const DVGLocationServiceDidChangeAuthorizationNotification = @"DVGLocationServiceDidChangeAuthorizationNotification";
+
+CLLocationDistance const kDVGLocationServiceQuantizationDistance = 100.0;
+
+static CLLocationDistance const kDVGMetersPerDegreeOfLatitude = 111320.0;
+
+@interface DVGLocationService () <CLLocationManagerDelegate>
+@property (nonatomic, strong) CLLocationManager *locationManager;
+@property (nonatomic, strong, readwrite) CLLocation *location;
+@property (nonatomic, strong, readwrite) CLLocation *pendingLocation;
+@property (nonatomic, assign) NSUInteger consumerCount;
+@end
+
+@implementation DVGLocationService
+
++ (instancetype)sharedService {
+    static DVGLocationService *sharedService;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedService = [[self alloc] init];
+    });
+
+    return sharedService;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _minimumUpdateInterval = 30.0;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    _locationManager.delegate = nil;
+}
+
+- (CLLocationManager *)locationManager {
+    if (!_locationManager) {
+        _locationManager = [[CLLocationManager alloc] init];
+        _locationManager.delegate = self;
+        // Fixes are quantized anyway, don't wake up for anything finer.
+        _locationManager.desiredAccuracy = kCLLocationAccuracyHundredMeters;
+        _locationManager.distanceFilter = kDVGLocationServiceQuantizationDistance / 2;
+    }
+
+    return _locationManager;
+}
+
+- (BOOL)isAuthorized {
+    CLAuthorizationStatus status = [CLLocationManager authorizationStatus];
+    return (status == kCLAuthorizationStatusAuthorized ||
+            status == kCLAuthorizationStatusAuthorizedAlways ||
+            status == kCLAuthorizationStatusAuthorizedWhenInUse);
+}
+
+- (void)start {
+    self.consumerCount++;
+    if (self.consumerCount > 1 || ![CLLocationManager locationServicesEnabled]) return;
+
+    if ([CLLocationManager authorizationStatus] == kCLAuthorizationStatusNotDetermined &&
+        [CLLocationManager instancesRespondToSelector:@selector(requestWhenInUseAuthorization)]) {
+        [self.locationManager requestWhenInUseAuthorization];
+    }
+    else {
+        [self.locationManager startUpdatingLocation];
+    }
+}
+
+- (void)stop {
+    NSParameterAssert(self.consumerCount > 0);
+    if (self.consumerCount == 0) return;
+
+    self.consumerCount--;
+    if (self.consumerCount == 0) {
+        [_locationManager stopUpdatingLocation];
+        [self cancelPendingLocation];
+    }
+}
+
+#pragma mark - Filtering
+
+static void DVGLocationCellIndex(CLLocationCoordinate2D coordinate, int64_t *latitudeIndex, int64_t *longitudeIndex, CLLocationCoordinate2D *center) {
+    double latitudeStep = kDVGLocationServiceQuantizationDistance / kDVGMetersPerDegreeOfLatitude;
+    *latitudeIndex = llround(coordinate.latitude / latitudeStep);
+    double latitude = *latitudeIndex * latitudeStep;
+
+    // Cell width depends on the latitude of the row, so rows have their own longitude grid.
+    double metersPerDegreeOfLongitude = MAX(kDVGMetersPerDegreeOfLatitude * cos(latitude * M_PI / 180.0), 1.0);
+    double longitudeStep = kDVGLocationServiceQuantizationDistance / metersPerDegreeOfLongitude;
+    *longitudeIndex = llround(coordinate.longitude / longitudeStep);
+
+    if (center) {
+        *center = CLLocationCoordinate2DMake(latitude, *longitudeIndex * longitudeStep);
+    }
+}
+
++ (CLLocationCoordinate2D)quantizedCoordinate:(CLLocationCoordinate2D)coordinate {
+    int64_t latitudeIndex, longitudeIndex;
+    CLLocationCoordinate2D center;
+    DVGLocationCellIndex(coordinate, &latitudeIndex, &longitudeIndex, &center);
+
+    return center;
+}
+
++ (BOOL)coordinate:(CLLocationCoordinate2D)coordinate isInSameCellAsCoordinate:(CLLocationCoordinate2D)otherCoordinate {
+    int64_t latitudeIndex, longitudeIndex, otherLatitudeIndex, otherLongitudeIndex;
+    DVGLocationCellIndex(coordinate, &latitudeIndex, &longitudeIndex, NULL);
+    DVGLocationCellIndex(otherCoordinate, &otherLatitudeIndex, &otherLongitudeIndex, NULL);
+
+    return (latitudeIndex == otherLatitudeIndex && longitudeIndex == otherLongitudeIndex);
+}
+
+- (BOOL)processLocation:(CLLocation *)location {
+    [[DVGMetrics sharedMetrics] addValue:1 toMetric:@"location.updates.received"];
+
+    if (location.horizontalAccuracy < 0) return NO;
+
+    CLLocationCoordinate2D coordinate = [[self class] quantizedCoordinate:location.coordinate];
+    CLLocation *quantizedLocation = [[CLLocation alloc] initWithCoordinate:coordinate
+                                                                  altitude:location.altitude
+                                                        horizontalAccuracy:MAX(location.horizontalAccuracy, kDVGLocationServiceQuantizationDistance)
+                                                          verticalAccuracy:location.verticalAccuracy
+                                                                 timestamp:location.timestamp];
+
+    if (self.location) {
+        // Cell indices rather than distance, a one-cell move measures less than the cell size on the ellipsoid.
+        if ([[self class] coordinate:coordinate isInSameCellAsCoordinate:self.location.coordinate]) {
+            [self cancelPendingLocation];
+            return NO;
+        }
+
+        // Too soon after the last one, publish it when the interval has passed unless a newer fix replaces it.
+        // With the distance filter a user who stopped in the new cell sends no more fixes.
+        NSTimeInterval interval = [quantizedLocation.timestamp timeIntervalSinceDate:self.location.timestamp];
+        if (interval < self.minimumUpdateInterval) {
+            [self cancelPendingLocation];
+            self.pendingLocation = quantizedLocation;
+            [self performSelector:@selector(publishPendingLocation) withObject:nil afterDelay:self.minimumUpdateInterval - interval];
+            return NO;
+        }
+    }
+
+    [self cancelPendingLocation];
+    [self publishLocation:quantizedLocation];
+
+    return YES;
+}
+
+- (void)publishPendingLocation {
+    CLLocation *location = self.pendingLocation;
+    self.pendingLocation = nil;
+    if (location) {
+        [self publishLocation:location];
+    }
+}
+
+- (void)cancelPendingLocation {
+    [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(publishPendingLocation) object:nil];
+    self.pendingLocation = nil;
+}
+
+- (void)publishLocation:(CLLocation *)location {
+    self.location = location;
+    [[DVGMetrics sharedMetrics] addValue:1 toMetric:@"location.updates.published"];
+    [[NSNotificationCenter defaultCenter] postNotificationName:DVGLocationServiceDidUpdateLocationNotification object:self];
+}
+
+#pragma mark - CLLocationManagerDelegate
+
+- (void)locationManager:(CLLocationManager *)manager didUpdateLocations:(NSArray *)locations {
+    for (CLLocation *location in locations) {
+        [self processLocation:location];
+    }
+}
+
+- (void)locationManager:(CLLocationManager *)manager didChangeAuthorizationStatus:(CLAuthorizationStatus)status {
+    if (self.authorized && self.consumerCount > 0) {
+        [manager startUpdatingLocation];
+    }
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:DVGLocationServiceDidChangeAuthorizationNotification object:self];
+}
+
+@end
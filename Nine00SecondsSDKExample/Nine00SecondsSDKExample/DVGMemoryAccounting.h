@@ -0,0 +1,33 @@
+//
+//  DVGMemoryAccounting.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+extern NSString *const DVGMemoryAccountingLiveBytesKey;
+extern NSString *const DVGMemoryAccountingPeakBytesKey;
+extern NSString *const DVGMemoryAccountingAllocationCountKey;
+
+/**
+ Byte counters of subsystems that report what they hold, logged with resident memory on memory warnings. Counts are only as good as the reports: DVGPager reports the shallow size of its item objects, not of the objects they reference.
+ Counters are published to DVGMetrics as memory.<subsystem>.live, .peak and .allocations together with memory.resident, whenever a metrics snapshot is taken.
+ Subsystems release their caches on UIApplicationDidReceiveMemoryWarningNotification themselves, the accounting only counts warnings and logs the state at that moment.
+ */
+@interface DVGMemoryAccounting : NSObject
+
++ (instancetype)sharedAccounting;
+
+- (void)recordAllocationOfBytes:(int64_t)bytes count:(NSUInteger)count forSubsystem:(NSString *)subsystem;
+- (void)recordDeallocationOfBytes:(int64_t)bytes forSubsystem:(NSString *)subsystem;
+
+//! Subsystem name to dictionary with live bytes, peak bytes and the number of allocations since launch. Has no side effects, rates are differences between snapshots.
+- (NSDictionary *)snapshot;
+
+//! Resident memory size of the process in bytes, 0 if unknown.
++ (uint64_t)residentMemorySize;
+
+@end
@@ -0,0 +1,129 @@
+//
+//  DVGMemoryAccounting.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGMemoryAccounting.h"
+#import "DVGMetrics.h"
+#import <mach/mach.h>
+@import UIKit;
+
+NSString *const DVGMemoryAccountingLiveBytesKey = @"live";
+NSString *const DVGMemoryAccountingPeakBytesKey = @"peak";
+NSString *const DVGMemoryAccountingAllocationCountKey = @"allocations";
+
+@interface DVGMemoryAccountingCounter : NSObject
+@property (nonatomic, assign) int64_t liveBytes;
+@property (nonatomic, assign) int64_t peakBytes;
+@property (nonatomic, assign) NSUInteger allocationCount;
+@end
+
+@implementation DVGMemoryAccountingCounter
+@end
+
+@interface DVGMemoryAccounting ()
+@property (nonatomic, strong) NSMutableDictionary *counters;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@end
+
+@implementation DVGMemoryAccounting
+
++ (instancetype)sharedAccounting {
+    static DVGMemoryAccounting *sharedAccounting;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedAccounting = [[self alloc] init];
+    });
+
+    return sharedAccounting;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _counters = [NSMutableDictionary dictionary];
+        _queue = dispatch_queue_create("com.denivip.memoryaccounting", DISPATCH_QUEUE_SERIAL);
+
+        @weakify(self);
+        [[DVGMetrics sharedMetrics] addSnapshotProvider:^(DVGMetrics *metrics) {
+            @strongify(self);
+            [self publishToMetrics:metrics];
+        }];
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(applicationDidReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (DVGMemoryAccountingCounter *)counterForSubsystem:(NSString *)subsystem {
+    DVGMemoryAccountingCounter *counter = self.counters[subsystem];
+    if (!counter) {
+        counter = [[DVGMemoryAccountingCounter alloc] init];
+        self.counters[subsystem] = counter;
+    }
+
+    return counter;
+}
+
+- (void)recordAllocationOfBytes:(int64_t)bytes count:(NSUInteger)count forSubsystem:(NSString *)subsystem {
+    dispatch_async(self.queue, ^{
+        DVGMemoryAccountingCounter *counter = [self counterForSubsystem:subsystem];
+        counter.liveBytes += bytes;
+        counter.peakBytes = MAX(counter.peakBytes, counter.liveBytes);
+        counter.allocationCount += count;
+    });
+}
+
+- (void)recordDeallocationOfBytes:(int64_t)bytes forSubsystem:(NSString *)subsystem {
+    dispatch_async(self.queue, ^{
+        DVGMemoryAccountingCounter *counter = [self counterForSubsystem:subsystem];
+        counter.liveBytes = MAX(counter.liveBytes - bytes, 0);
+    });
+}
+
+- (NSDictionary *)snapshot {
+    __block NSMutableDictionary *snapshot = [NSMutableDictionary dictionary];
+    dispatch_sync(self.queue, ^{
+        [self.counters enumerateKeysAndObjectsUsingBlock:^(NSString *subsystem, DVGMemoryAccountingCounter *counter, BOOL *stop) {
+            snapshot[subsystem] = @{ DVGMemoryAccountingLiveBytesKey : @(counter.liveBytes),
+                                     DVGMemoryAccountingPeakBytesKey : @(counter.peakBytes),
+                                     DVGMemoryAccountingAllocationCountKey : @(counter.allocationCount) };
+        }];
+    });
+
+    return snapshot;
+}
+
+- (void)publishToMetrics:(DVGMetrics *)metrics {
+    [[self snapshot] enumerateKeysAndObjectsUsingBlock:^(NSString *subsystem, NSDictionary *values, BOOL *stop) {
+        [values enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *value, BOOL *stop) {
+            [metrics setValue:value.doubleValue forMetric:[NSString stringWithFormat:@"memory.%@.%@", subsystem, key]];
+        }];
+    }];
+    [metrics setValue:[[self class] residentMemorySize] forMetric:@"memory.resident"];
+}
+
++ (uint64_t)residentMemorySize {
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    kern_return_t result = task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count);
+
+    return (result == KERN_SUCCESS) ? info.resident_size : 0;
+}
+
+#pragma mark - Notifications
+
+- (void)applicationDidReceiveMemoryWarning:(NSNotification *)notification {
+    [[DVGMetrics sharedMetrics] addValue:1 toMetric:@"memory.warnings"];
+    DVGLog(@"Memory warning, resident %llu KB : %@", [[self class] residentMemorySize] / 1024, [self snapshot]);
+}
+
+@end
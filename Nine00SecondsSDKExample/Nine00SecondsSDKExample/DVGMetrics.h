@@ -0,0 +1,33 @@
+//
+//  DVGMetrics.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ Process-wide registry of named numeric metrics. Values can be set or accumulated from any thread, snapshot returns a consistent copy of all of them.
+ */
+@interface DVGMetrics : NSObject
+
++ (instancetype)sharedMetrics;
+
+- (void)setValue:(double)value forMetric:(NSString *)name;
+- (void)addValue:(double)value toMetric:(NSString *)name;
+- (double)valueForMetric:(NSString *)name;
+
+//! Block is called on the calling thread before every snapshot, to set metrics that are computed on demand.
+- (void)addSnapshotProvider:(void (^)(DVGMetrics *metrics))provider;
+
+//! Metric name to NSNumber value.
+- (NSDictionary *)snapshot;
+
+//! Logs a snapshot with DVGLog, one metric per line in name order.
+- (void)logSnapshot;
+
+- (void)reset;
+
+@end
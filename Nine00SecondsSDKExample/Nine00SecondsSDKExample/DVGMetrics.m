@@ -0,0 +1,102 @@
+//
+//  DVGMetrics.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGMetrics.h"
+
+@interface DVGMetrics ()
+@property (nonatomic, strong) NSMutableDictionary *values;
+@property (nonatomic, strong) NSMutableArray *snapshotProviders;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@end
+
+@implementation DVGMetrics
+
++ (instancetype)sharedMetrics {
+    static DVGMetrics *sharedMetrics;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedMetrics = [[self alloc] init];
+    });
+
+    return sharedMetrics;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _values = [NSMutableDictionary dictionary];
+        _snapshotProviders = [NSMutableArray array];
+        _queue = dispatch_queue_create("com.denivip.metrics", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
+- (void)setValue:(double)value forMetric:(NSString *)name {
+    dispatch_async(self.queue, ^{
+        self.values[name] = @(value);
+    });
+}
+
+- (void)addValue:(double)value toMetric:(NSString *)name {
+    dispatch_async(self.queue, ^{
+        self.values[name] = @([self.values[name] doubleValue] + value);
+    });
+}
+
+- (double)valueForMetric:(NSString *)name {
+    __block double value;
+    dispatch_sync(self.queue, ^{
+        value = [self.values[name] doubleValue];
+    });
+
+    return value;
+}
+
+- (void)addSnapshotProvider:(void (^)(DVGMetrics *metrics))provider {
+    dispatch_async(self.queue, ^{
+        [self.snapshotProviders addObject:[provider copy]];
+    });
+}
+
+- (NSDictionary *)snapshot {
+    __block NSArray *snapshotProviders;
+    dispatch_sync(self.queue, ^{
+        snapshotProviders = [self.snapshotProviders copy];
+    });
+
+    // Providers set values asynchronously, they are on the queue before the snapshot is read.
+    for (void (^provider)(DVGMetrics *) in snapshotProviders) {
+        provider(self);
+    }
+
+    __block NSDictionary *snapshot;
+    dispatch_sync(self.queue, ^{
+        snapshot = [self.values copy];
+    });
+
+    return snapshot;
+}
+
+- (void)logSnapshot {
+    NSDictionary *snapshot = [self snapshot];
+    DVGLog(@"Metrics snapshot, %lu values", (unsigned long)snapshot.count);
+
+    // Separate records, so that each of them fits into a flight recorder slot.
+    for (NSString *name in [snapshot.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        DVGLog(@"  %@ = %@", name, snapshot[name]);
+    }
+}
+
+- (void)reset {
+    dispatch_async(self.queue, ^{
+        [self.values removeAllObjects];
+    });
+}
+
+@end
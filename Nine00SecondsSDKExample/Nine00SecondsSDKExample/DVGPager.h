@@ -0,0 +1,67 @@
+//
+//  DVGPager.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+typedef void (^DVGPagerFetchCompletion)(NSArray *items, NSError *error);
+
+//! Fetches a page of items created before untilDate, or the most recent page if untilDate is nil.
+typedef void (^DVGPagerFetchBlock)(NSDate *untilDate, DVGPagerFetchCompletion completion);
+
+@class DVGPager;
+
+@protocol DVGPagerDelegate <NSObject>
+
+- (void)pagerDidUpdateItems:(DVGPager *)pager;
+
+@end
+
+/**
+ Cursor-based pager over the untilDate-paginated backend lists. Items are deduplicated by identifier across pages and the next page is requested before the list is scrolled to its end. On memory warnings items far below the visible ones are dropped and fetched again when needed.
+ */
+@interface DVGPager : NSObject
+
+@property (nonatomic, weak) id<DVGPagerDelegate> delegate;
+
+//! Backend page size, a shorter page means the list has ended. Defaults to 30.
+@property (nonatomic, assign) NSUInteger pageSize;
+
+//! Next page is requested when an item this close to the end becomes visible. Defaults to 10.
+@property (nonatomic, assign) NSUInteger prefetchDistance;
+
+//! Subsystem name for DVGMemoryAccounting. Defaults to "pager".
+@property (nonatomic, copy) NSString *accountingSubsystem;
+
+//! Not a copy, contents change when the delegate is notified.
+@property (nonatomic, strong, readonly) NSArray *items;
+@property (nonatomic, readonly) BOOL hasMoreItems;
+@property (nonatomic, readonly, getter=isLoading) BOOL loading;
+
+/**
+ @param fetchBlock Block performing backend request.
+ @param identifierKeyPath Key path of the unique item identifier.
+ @param dateKeyPath Key path of the item date used as the cursor for the next page.
+ */
+- (instancetype)initWithFetchBlock:(DVGPagerFetchBlock)fetchBlock
+                 identifierKeyPath:(NSString *)identifierKeyPath
+                       dateKeyPath:(NSString *)dateKeyPath;
+
+//! Fetches the first page again. Loaded items stay until it arrives, then they are replaced with it.
+- (void)reload;
+
+- (void)loadNextPage;
+
+//! Call when an item is about to be shown to prefetch the next page in time.
+- (void)itemWillBecomeVisibleAtIndex:(NSUInteger)index;
+
+- (void)removeItemAtIndex:(NSUInteger)index;
+
+//! Drops items past the prefetch distance from the last visible one, they are fetched again when scrolled to. Called on memory warnings.
+- (void)trimToVisibleItems;
+
+@end
@@ -0,0 +1,193 @@
+//
+//  DVGPager.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGPager.h"
+#import "DVGMetrics.h"
+#import "DVGMemoryAccounting.h"
+#import <malloc/malloc.h>
+@import UIKit;
+
+@interface DVGPager ()
+@property (nonatomic, copy) DVGPagerFetchBlock fetchBlock;
+@property (nonatomic, copy) NSString *identifierKeyPath;
+@property (nonatomic, copy) NSString *dateKeyPath;
+
+@property (nonatomic, strong) NSMutableArray *mutableItems;
+@property (nonatomic, strong) NSMutableSet *identifiers;
+@property (nonatomic, strong) NSDate *cursorDate;
+@property (nonatomic, readwrite) BOOL hasMoreItems;
+@property (nonatomic, readwrite) BOOL loading;
+@property (nonatomic, assign) BOOL reloading;
+@property (nonatomic, assign) NSUInteger generation;
+@property (nonatomic, assign) NSUInteger lastVisibleIndex;
+@end
+
+@implementation DVGPager
+
+- (instancetype)initWithFetchBlock:(DVGPagerFetchBlock)fetchBlock
+                 identifierKeyPath:(NSString *)identifierKeyPath
+                       dateKeyPath:(NSString *)dateKeyPath {
+    self = [super init];
+    if (self) {
+        _fetchBlock = [fetchBlock copy];
+        _identifierKeyPath = [identifierKeyPath copy];
+        _dateKeyPath = [dateKeyPath copy];
+        _pageSize = 30;
+        _prefetchDistance = 10;
+        _mutableItems = [NSMutableArray array];
+        _identifiers = [NSMutableSet set];
+        _hasMoreItems = YES;
+        _accountingSubsystem = @"pager";
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(applicationDidReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [self accountRemovedItems:_mutableItems];
+}
+
+- (NSArray *)items {
+    return self.mutableItems;
+}
+
+- (void)reload {
+    // Responses of requests issued before reload are ignored.
+    self.generation++;
+    self.loading = NO;
+    self.reloading = YES;
+
+    [self fetchItemsUntilDate:nil];
+}
+
+- (void)loadNextPage {
+    if (self.loading || !self.hasMoreItems) return;
+
+    [self fetchItemsUntilDate:self.cursorDate];
+}
+
+- (void)fetchItemsUntilDate:(NSDate *)untilDate {
+    self.loading = YES;
+    NSUInteger generation = self.generation;
+    NSDate *requestDate = [NSDate date];
+
+    @weakify(self);
+    self.fetchBlock(untilDate, ^(NSArray *items, NSError *error) {
+        @strongify(self);
+        if (!self || generation != self.generation) return;
+
+        self.loading = NO;
+        [[DVGMetrics sharedMetrics] setValue:-[requestDate timeIntervalSinceNow] forMetric:@"pager.lastFetchTime"];
+
+        if (!items) {
+            DVGLog(@"Failed to fetch page : %@", error);
+            // Failed reload keeps the loaded items.
+            self.reloading = NO;
+            [self.delegate pagerDidUpdateItems:self];
+            return;
+        }
+
+        if (self.reloading) {
+            self.reloading = NO;
+            self.lastVisibleIndex = 0;
+            [self removeItemsInRange:NSMakeRange(0, self.mutableItems.count)];
+        }
+
+        [self appendItems:items];
+        [self.delegate pagerDidUpdateItems:self];
+    });
+}
+
+- (void)appendItems:(NSArray *)items {
+    self.hasMoreItems = (items.count >= self.pageSize);
+
+    NSMutableArray *addedItems = [NSMutableArray arrayWithCapacity:items.count];
+    for (id item in items) {
+        id identifier = [item valueForKeyPath:self.identifierKeyPath];
+        if (!identifier || [self.identifiers containsObject:identifier]) continue;
+
+        [self.identifiers addObject:identifier];
+        [addedItems addObject:item];
+    }
+    [self.mutableItems addObjectsFromArray:addedItems];
+    [[DVGMemoryAccounting sharedAccounting] recordAllocationOfBytes:[self sizeOfItems:addedItems] count:addedItems.count forSubsystem:self.accountingSubsystem];
+
+    NSDate *lastDate = [[items lastObject] valueForKeyPath:self.dateKeyPath];
+    if (lastDate) {
+        self.cursorDate = lastDate;
+    }
+    else {
+        self.hasMoreItems = NO;
+    }
+}
+
+- (void)itemWillBecomeVisibleAtIndex:(NSUInteger)index {
+    self.lastVisibleIndex = index;
+    if (index + self.prefetchDistance < self.mutableItems.count) return;
+
+    if (self.loading && index + 1 >= self.mutableItems.count) {
+        // Scrolled to the very end before the prefetch has completed.
+        [[DVGMetrics sharedMetrics] addValue:1 toMetric:@"pager.fetchStalls"];
+    }
+
+    [self loadNextPage];
+}
+
+- (void)removeItemAtIndex:(NSUInteger)index {
+    [self removeItemsInRange:NSMakeRange(index, 1)];
+}
+
+- (void)removeItemsInRange:(NSRange)range {
+    NSArray *removedItems = [self.mutableItems subarrayWithRange:range];
+    for (id item in removedItems) {
+        [self.identifiers removeObject:[item valueForKeyPath:self.identifierKeyPath]];
+    }
+    [self.mutableItems removeObjectsInRange:range];
+    [self accountRemovedItems:removedItems];
+}
+
+- (void)trimToVisibleItems {
+    NSUInteger keptCount = MAX(self.lastVisibleIndex + 1 + self.prefetchDistance, self.pageSize);
+    if (self.mutableItems.count <= keptCount) return;
+
+    // Responses of requests issued before trimming would no longer continue the list.
+    self.generation++;
+    self.loading = NO;
+    self.reloading = NO;
+    [self removeItemsInRange:NSMakeRange(keptCount, self.mutableItems.count - keptCount)];
+    self.cursorDate = [[self.mutableItems lastObject] valueForKeyPath:self.dateKeyPath];
+    self.hasMoreItems = YES;
+
+    [self.delegate pagerDidUpdateItems:self];
+}
+
+#pragma mark - Memory
+
+- (int64_t)sizeOfItems:(NSArray *)items {
+    // Shallow size of the item objects only, their strings and dates are not counted.
+    int64_t size = 0;
+    for (id item in items) {
+        size += malloc_size((__bridge const void *)item);
+    }
+
+    return size;
+}
+
+- (void)accountRemovedItems:(NSArray *)items {
+    if (items.count == 0) return;
+    [[DVGMemoryAccounting sharedAccounting] recordDeallocationOfBytes:[self sizeOfItems:items] forSubsystem:self.accountingSubsystem];
+}
+
+- (void)applicationDidReceiveMemoryWarning:(NSNotification *)notification {
+    [self trimToVisibleItems];
+}
+
+@end
@@ -0,0 +1,59 @@
+//
+//  DVGPerformanceGovernor.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "Nine00SecondsSDK.h"
+
+@class DVGUploadPolicy;
+
+//! Mirrors NSProcessInfoThermalState, which is not available on every supported system.
+typedef NS_ENUM(NSInteger, DVGThermalState) {
+    DVGThermalStateNominal,
+    DVGThermalStateFair,
+    DVGThermalStateSerious,
+    DVGThermalStateCritical
+};
+
+@interface DVGPerformanceSample : NSObject
+
+@property (nonatomic, assign) NSTimeInterval timestamp;
+@property (nonatomic, assign) DVGThermalState thermalState;
+//! 0...1, negative if unknown.
+@property (nonatomic, assign) float batteryLevel;
+@property (nonatomic, assign, getter=isCharging) BOOL charging;
+
+@end
+
+/**
+ Keeps long broadcasts sustainable by capping the quality preset before the device throttles the encoder.
+ Pressure steps the preset down at once, recovery steps it back up one preset at a time once conditions stay good for recoveryInterval.
+ The cap is applied through DVGUploadPolicy, together with network limits.
+ */
+@interface DVGPerformanceGovernor : NSObject
+
++ (instancetype)sharedGovernor;
+
+- (instancetype)initWithUploadPolicy:(DVGUploadPolicy *)uploadPolicy;
+
+//! How long conditions have to stay good before the next step up. Defaults to 120 seconds.
+@property (nonatomic, assign) NSTimeInterval recoveryInterval;
+
+@property (nonatomic, readonly) NHSStreamingQualityPreset sustainableQualityPreset;
+@property (nonatomic, strong, readonly) DVGPerformanceSample *lastSample;
+
+//! Enables battery monitoring and samples sensors periodically. Keep it on only while a broadcast can be started, the preset is applied at broadcast start.
+- (void)startMonitoring;
+- (void)stopMonitoring;
+
+//! Reads current sensors. Used when monitoring, sample timestamps come from the system uptime.
+- (DVGPerformanceSample *)currentSample;
+
+//! Advances the governor with a sample. Depends only on the sample and previous samples, so it can be driven by scripted traces.
+- (void)processSample:(DVGPerformanceSample *)sample;
+
+@end
@@ -0,0 +1,175 @@
+//
+//  DVGPerformanceGovernor.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGPerformanceGovernor.h"
+#import "DVGUploadPolicy.h"
+#import "DVGQualityPresetUtilities.h"
+#import "DVGMetrics.h"
+@import UIKit;
+
+static NSString *const kDVGThermalStateDidChangeNotification = @"NSProcessInfoThermalStateDidChangeNotification";
+static NSTimeInterval const kDVGPerformanceGovernorSampleInterval = 30.0;
+static float const kDVGPerformanceGovernorLowBatteryLevel = 0.2f;
+static float const kDVGPerformanceGovernorCriticalBatteryLevel = 0.1f;
+
+@implementation DVGPerformanceSample
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; thermalState = %ld; batteryLevel = %.2f; charging = %d>",
+            [self class], self, (long)self.thermalState, self.batteryLevel, self.charging];
+}
+
+@end
+
+@interface DVGPerformanceGovernor ()
+@property (nonatomic, strong) DVGUploadPolicy *uploadPolicy;
+@property (nonatomic, strong) NSTimer *sampleTimer;
+@property (nonatomic, readwrite) NHSStreamingQualityPreset sustainableQualityPreset;
+@property (nonatomic, strong, readwrite) DVGPerformanceSample *lastSample;
+//! Time of the last step down or of the last sample that didn't allow stepping up.
+@property (nonatomic, assign) NSTimeInterval lastPressureTimestamp;
+@end
+
+@implementation DVGPerformanceGovernor
+
++ (instancetype)sharedGovernor {
+    static DVGPerformanceGovernor *sharedGovernor;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedGovernor = [[self alloc] initWithUploadPolicy:[DVGUploadPolicy sharedPolicy]];
+    });
+
+    return sharedGovernor;
+}
+
+- (instancetype)initWithUploadPolicy:(DVGUploadPolicy *)uploadPolicy {
+    self = [super init];
+    if (self) {
+        _uploadPolicy = uploadPolicy;
+        _recoveryInterval = 120.0;
+        _sustainableQualityPreset = NHSStreamingQualityPreset1280HighBitrate;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [_sampleTimer invalidate];
+}
+
+- (void)startMonitoring {
+    if (self.sampleTimer) return;
+
+    [UIDevice currentDevice].batteryMonitoringEnabled = YES;
+
+    NSNotificationCenter *notificationCenter = [NSNotificationCenter defaultCenter];
+    [notificationCenter addObserver:self selector:@selector(sensorsDidChange:) name:UIDeviceBatteryLevelDidChangeNotification object:nil];
+    [notificationCenter addObserver:self selector:@selector(sensorsDidChange:) name:UIDeviceBatteryStateDidChangeNotification object:nil];
+    [notificationCenter addObserver:self selector:@selector(sensorsDidChange:) name:kDVGThermalStateDidChangeNotification object:nil];
+
+    // Periodic samples let the preset recover when no notification arrives.
+    self.sampleTimer = [NSTimer timerWithTimeInterval:kDVGPerformanceGovernorSampleInterval target:self selector:@selector(sampleTimerAction) userInfo:nil repeats:YES];
+    [[NSRunLoop mainRunLoop] addTimer:self.sampleTimer forMode:NSRunLoopCommonModes];
+
+    [self processSample:[self currentSample]];
+}
+
+- (void)stopMonitoring {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [self.sampleTimer invalidate];
+    self.sampleTimer = nil;
+    [UIDevice currentDevice].batteryMonitoringEnabled = NO;
+}
+
+- (void)sensorsDidChange:(NSNotification *)notification {
+    // Thermal state notification is posted on an arbitrary queue.
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self processSample:[self currentSample]];
+    });
+}
+
+- (void)sampleTimerAction {
+    [self processSample:[self currentSample]];
+}
+
+- (DVGPerformanceSample *)currentSample {
+    DVGPerformanceSample *sample = [[DVGPerformanceSample alloc] init];
+    sample.timestamp = [[NSProcessInfo processInfo] systemUptime];
+
+    NSProcessInfo *processInfo = [NSProcessInfo processInfo];
+    if ([processInfo respondsToSelector:NSSelectorFromString(@"thermalState")]) {
+        sample.thermalState = [[processInfo valueForKey:@"thermalState"] integerValue];
+    }
+
+    UIDevice *device = [UIDevice currentDevice];
+    sample.batteryLevel = device.batteryLevel;
+    sample.charging = (device.batteryState == UIDeviceBatteryStateCharging || device.batteryState == UIDeviceBatteryStateFull);
+
+    return sample;
+}
+
+#pragma mark - Governor
+
+- (void)processSample:(DVGPerformanceSample *)sample {
+    NHSStreamingQualityPreset ceiling = NHSStreamingQualityPreset1280HighBitrate;
+    BOOL holdsStepUp = NO;
+
+    switch (sample.thermalState) {
+        case DVGThermalStateCritical:
+            ceiling = NHSStreamingQualityPreset480;
+            break;
+
+        case DVGThermalStateSerious:
+            ceiling = NHSStreamingQualityPreset640;
+            break;
+
+        case DVGThermalStateFair:
+            holdsStepUp = YES;
+            break;
+
+        case DVGThermalStateNominal:
+            break;
+    }
+
+    BOOL batteryKnown = (sample.batteryLevel >= 0);
+    if (batteryKnown && !sample.charging) {
+        if (sample.batteryLevel < kDVGPerformanceGovernorCriticalBatteryLevel) {
+            ceiling = MIN(ceiling, NHSStreamingQualityPreset640);
+        }
+        else if (sample.batteryLevel < kDVGPerformanceGovernorLowBatteryLevel) {
+            holdsStepUp = YES;
+        }
+    }
+
+    NHSStreamingQualityPreset preset = self.sustainableQualityPreset;
+    if (ceiling < preset) {
+        preset = ceiling;
+        self.lastPressureTimestamp = sample.timestamp;
+    }
+    else if (holdsStepUp || ceiling == preset) {
+        self.lastPressureTimestamp = sample.timestamp;
+    }
+    else if (sample.timestamp - self.lastPressureTimestamp >= self.recoveryInterval) {
+        preset++;
+        self.lastPressureTimestamp = sample.timestamp;
+    }
+
+    self.lastSample = sample;
+
+    if (preset != self.sustainableQualityPreset) {
+        DVGLog(@"Sustainable quality preset %@ -> %@ %@",
+               DVGQualityPresetDescription(self.sustainableQualityPreset), DVGQualityPresetDescription(preset), sample);
+        [[DVGMetrics sharedMetrics] addValue:1 toMetric:(preset < self.sustainableQualityPreset ? @"governor.stepsDown" : @"governor.stepsUp")];
+
+        self.sustainableQualityPreset = preset;
+        self.uploadPolicy.sustainableQualityPreset = preset;
+    }
+}
+
+@end
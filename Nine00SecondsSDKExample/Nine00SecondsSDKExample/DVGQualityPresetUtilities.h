@@ -0,0 +1,24 @@
+//
+//  DVGQualityPresetUtilities.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "Nine00SecondsSDK.h"
+
+//! Duration of a single .ts chunk produced by the SDK.
+extern NSTimeInterval const kDVGSegmentDuration;
+
+//! Share of measured uplink throughput a preset may use, the rest is headroom for TCP and HTTP overhead.
+extern double const kDVGUsableThroughputRatio;
+
+//! Nominal video bitrate of the preset in kbps, as documented in NHSBroadcastManager.h.
+double DVGBitrateForQualityPreset(NHSStreamingQualityPreset preset);
+
+//! Highest preset whose nominal bitrate fits into the given bitrate. Never goes below NHSStreamingQualityPreset480.
+NHSStreamingQualityPreset DVGHighestQualityPresetForBitrate(double kbps);
+
+NSString *DVGQualityPresetDescription(NHSStreamingQualityPreset preset);
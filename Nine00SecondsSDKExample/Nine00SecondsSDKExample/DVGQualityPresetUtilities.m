@@ -0,0 +1,50 @@
+//
+//  DVGQualityPresetUtilities.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGQualityPresetUtilities.h"
+
+NSTimeInterval const kDVGSegmentDuration = 8.0;
+double const kDVGUsableThroughputRatio = 0.8;
+
+double DVGBitrateForQualityPreset(NHSStreamingQualityPreset preset)
+{
+    switch (preset) {
+        case NHSStreamingQualityPreset480:              return 464.0;
+        case NHSStreamingQualityPreset640:              return 664.0;
+        case NHSStreamingQualityPreset640HighBitrate:   return 1296.0;
+        case NHSStreamingQualityPreset960:              return 3596.0;
+        case NHSStreamingQualityPreset1280:             return 5128.0;
+        case NHSStreamingQualityPreset1280HighBitrate:  return 6628.0;
+    }
+
+    return 664.0;
+}
+
+NHSStreamingQualityPreset DVGHighestQualityPresetForBitrate(double kbps)
+{
+    NHSStreamingQualityPreset preset = NHSStreamingQualityPreset1280HighBitrate;
+    while (preset > NHSStreamingQualityPreset480 && DVGBitrateForQualityPreset(preset) > kbps) {
+        preset--;
+    }
+
+    return preset;
+}
+
+NSString *DVGQualityPresetDescription(NHSStreamingQualityPreset preset)
+{
+    switch (preset) {
+        case NHSStreamingQualityPreset480:              return @"480";
+        case NHSStreamingQualityPreset640:              return @"640";
+        case NHSStreamingQualityPreset640HighBitrate:   return @"640HighBitrate";
+        case NHSStreamingQualityPreset960:              return @"960";
+        case NHSStreamingQualityPreset1280:             return @"1280";
+        case NHSStreamingQualityPreset1280HighBitrate:  return @"1280HighBitrate";
+    }
+
+    return @"unknown";
+}
@@ -25,14 +25,19 @@ typedef NS_ENUM(NSUInteger, DVGStreamsDataControllerType) {
 @interface DVGStreamsDataController : NSObject
 
 @property (nonatomic, weak) id<DVGStreamsDataControllerDelegate> delegate;
-@property (nonatomic, copy) NSArray *streams;
+@property (nonatomic, strong, readonly) NSArray *streams;
+@property (nonatomic, readonly) BOOL hasMoreStreams;
 
 @property (nonatomic, assign) DVGStreamsDataControllerType type;
 @property (nonatomic, assign) CLLocationCoordinate2D coordinate;
 @property (nonatomic, assign) float radius;
 @property (nonatomic, strong) NSDate *sinceDate;
 
+//! Drops loaded pages and fetches the most recent one.
 - (void)refresh;
 - (void)removeStreamAtIndex:(NSUInteger)index;
 
+//! Prefetches the next page when the list is scrolled close to its end.
+- (void)willDisplayStreamAtIndex:(NSUInteger)index;
+
 @end
@@ -7,49 +7,71 @@
 //
 
 #import "DVGStreamsDataController.h"
+#import "DVGPager.h"
 #import "Nine00SecondsSDK.h"
 
-@interface DVGStreamsDataController ()
-
+@interface DVGStreamsDataController () <DVGPagerDelegate>
+@property (nonatomic, strong) DVGPager *pager;
 @end
 
 @implementation DVGStreamsDataController
 
-- (void)refresh
+- (instancetype)init
 {
-    if (self.type == DVGStreamsDataControllerTypeRecent) {
+    self = [super init];
+    if (self) {
         @weakify(self);
-        [[NHSBroadcastManager sharedManager] fetchStreamsUntilDate:nil withCompletion:^(NSArray *streams, NSInteger totalNumber, NSError *error) {
+        _pager = [[DVGPager alloc] initWithFetchBlock:^(NSDate *untilDate, DVGPagerFetchCompletion completion) {
             @strongify(self);
-            if (streams) {
-                self.streams = streams;
-            }
-            else {
-                // To hide activity indicator
-                [self.delegate streamsDataControllerDidUpdateStreams:self];
-            }
-        }];
+            [self fetchStreamsUntilDate:untilDate completion:completion];
+        } identifierKeyPath:@"streamID" dateKeyPath:@"createdAt"];
+        _pager.delegate = self;
+        _pager.accountingSubsystem = @"streams.list";
+    }
+
+    return self;
+}
+
+- (void)fetchStreamsUntilDate:(NSDate *)untilDate completion:(DVGPagerFetchCompletion)completion
+{
+    NHSBroadcastFetchCompletion fetchCompletion = ^(NSArray *streams, NSInteger totalNumber, NSError *error) {
+        completion(streams, error);
+    };
+
+    if (self.type == DVGStreamsDataControllerTypeRecent) {
+        [[NHSBroadcastManager sharedManager] fetchStreamsUntilDate:untilDate withCompletion:fetchCompletion];
     } else {
         [[NHSBroadcastManager sharedManager] fetchStreamsNearCoordinate:self.coordinate
                                                              withRadius:self.radius
-                                                              untilDate:self.sinceDate
-                                                         withCompletion:^(NSArray *streamsArray, NSInteger totalNumber, NSError *error) {
-                                                             if (streamsArray.count) {
-                                                                 self.streams = streamsArray;
-                                                             } else {
-                                                                 [self.delegate streamsDataControllerDidUpdateStreams:self];
-                                                             }
-        }];
+                                                              untilDate:untilDate ?: self.sinceDate
+                                                         withCompletion:fetchCompletion];
     }
 }
 
+- (NSArray *)streams
+{
+    return self.pager.items;
+}
+
+- (BOOL)hasMoreStreams
+{
+    return self.pager.hasMoreItems;
+}
+
+- (void)refresh
+{
+    [self.pager reload];
+}
+
+- (void)willDisplayStreamAtIndex:(NSUInteger)index
+{
+    [self.pager itemWillBecomeVisibleAtIndex:index];
+}
+
 - (void)removeStreamAtIndex:(NSUInteger)index
 {
     NHSStream *stream = self.streams[index];
-
-    NSMutableArray *streams = [self.streams mutableCopy];
-    [streams removeObjectAtIndex:index];
-    _streams = [NSArray arrayWithArray:streams];
+    [self.pager removeItemAtIndex:index];
 
     @weakify(self);
     [[NHSBroadcastManager sharedManager] removeStreamWithID:stream.streamID completion:^(NSError *error) {
@@ -58,9 +80,10 @@
     }];
 }
 
-- (void)setStreams:(NSArray *)streams
+#pragma mark - DVGPagerDelegate
+
+- (void)pagerDidUpdateItems:(DVGPager *)pager
 {
-    _streams = [streams copy];
     [self.delegate streamsDataControllerDidUpdateStreams:self];
 }
 
@@ -18,15 +18,13 @@
 #import "DVGStreamSelectionViewController.h"
 #import "DVGStreamsDataController.h"
 #import "AFHTTPRequestOperation.h"
+#import "DVGLocationService.h"
 
 @interface DVGStreamsMapViewController ()
-<MKMapViewDelegate,
-CLLocationManagerDelegate>
+<MKMapViewDelegate>
 
 @property (weak, nonatomic) IBOutlet MKMapView *mapView;
 @property (weak, nonatomic) IBOutlet UIView *playerBackgroundView;
-// Only for requesting authorization.
-@property (strong, nonatomic) CLLocationManager *locationManager;
 @property (nonatomic) BOOL didSnapToInitialLocation;
 @property (copy, nonatomic) NSArray *streams;
 @property (copy, nonatomic) NSArray *visibleStreams;
@@ -45,7 +43,7 @@ CLLocationManagerDelegate>
 - (void)dealloc
 {
     [NSObject cancelPreviousPerformRequestsWithTarget:self];
-    _locationManager.delegate = nil;
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
     [_fetchRequestOperation cancel];
 }
 
@@ -72,20 +70,34 @@ CLLocationManagerDelegate>
 {
     [super viewDidAppear:animated];
 
-    if ([CLLocationManager locationServicesEnabled] &&
-        [CLLocationManager authorizationStatus] == kCLAuthorizationStatusNotDetermined &&
-        [CLLocationManager instancesRespondToSelector:@selector(requestWhenInUseAuthorization)]) {
-        self.locationManager = [[CLLocationManager alloc] init];
-        self.locationManager.delegate = self;
-        [self.locationManager requestWhenInUseAuthorization];
+    NSNotificationCenter *notificationCenter = [NSNotificationCenter defaultCenter];
+    [notificationCenter removeObserver:self name:DVGLocationServiceDidUpdateLocationNotification object:nil];
+    [notificationCenter addObserver:self selector:@selector(locationServiceDidUpdateLocation:) name:DVGLocationServiceDidUpdateLocationNotification object:nil];
+
+    if ([CLLocationManager authorizationStatus] == kCLAuthorizationStatusNotDetermined) {
+        [notificationCenter removeObserver:self name:DVGLocationServiceDidChangeAuthorizationNotification object:nil];
+        [notificationCenter addObserver:self selector:@selector(locationServiceDidChangeAuthorization:) name:DVGLocationServiceDidChangeAuthorizationNotification object:nil];
     }
     else {
         self.mapView.showsUserLocation = YES;
     }
+    [[DVGLocationService sharedService] start];
 
+    [self snapToUserLocationAnimated:NO];
     [self setNeedsToRefreshData];
 }
 
+- (void)viewWillDisappear:(BOOL)animated
+{
+    [super viewWillDisappear:animated];
+
+    // MapKit runs its own location updates for the user location dot, they are not needed off screen either.
+    self.mapView.showsUserLocation = NO;
+    [[NSNotificationCenter defaultCenter] removeObserver:self name:DVGLocationServiceDidUpdateLocationNotification object:nil];
+    [[NSNotificationCenter defaultCenter] removeObserver:self name:DVGLocationServiceDidChangeAuthorizationNotification object:nil];
+    [[DVGLocationService sharedService] stop];
+}
+
 - (void)prepareForSegue:(UIStoryboardSegue *)segue sender:(id)sender {
     if ([segue.identifier isEqualToString:@"mapList"]) {
         DVGStreamSelectionViewController *controller = segue.destinationViewController;
@@ -122,7 +134,7 @@ CLLocationManagerDelegate>
 {
     if (self.didSnapToInitialLocation) return;
 
-    CLLocation *userLocation = self.mapView.userLocation.location;
+    CLLocation *userLocation = [DVGLocationService sharedService].location;
     if (userLocation) {
         MKCoordinateRegion region = MKCoordinateRegionMake(userLocation.coordinate, MKCoordinateSpanMake(0.5, 0.5));
         [self.mapView setRegion:region animated:animated];
@@ -222,13 +234,17 @@ CLLocationManagerDelegate>
 //    return _visibleStreams;
 //}
 
-#pragma mark - CLLocationManagerDelegate
+#pragma mark - Location service
 
-- (void)locationManager:(CLLocationManager *)manager didChangeAuthorizationStatus:(CLAuthorizationStatus)status
+- (void)locationServiceDidUpdateLocation:(NSNotification *)notification
 {
-    if (status != kCLAuthorizationStatusNotDetermined) {
-        self.locationManager.delegate = nil;
-        self.locationManager = nil;
+    [self snapToUserLocationAnimated:YES];
+}
+
+- (void)locationServiceDidChangeAuthorization:(NSNotification *)notification
+{
+    if ([CLLocationManager authorizationStatus] != kCLAuthorizationStatusNotDetermined) {
+        [[NSNotificationCenter defaultCenter] removeObserver:self name:DVGLocationServiceDidChangeAuthorizationNotification object:nil];
         self.mapView.showsUserLocation = YES;
     }
 }
@@ -293,11 +309,6 @@ CLLocationManagerDelegate>
     return overlayRenderer;
 }
 
-- (void)mapView:(MKMapView *)mapView didUpdateUserLocation:(MKUserLocation *)userLocation
-{
-    [self snapToUserLocationAnimated:YES];
-}
-
 - (void)mapView:(MKMapView *)mapView regionDidChangeAnimated:(BOOL)animated
 {
     [self.clusteringController refresh:YES];
@@ -0,0 +1,58 @@
+//
+//  DVGUplinkMonitor.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "Nine00SecondsSDK.h"
+
+@class DVGUplinkMonitor, DVGUploadProgressBus;
+
+@protocol DVGUplinkMonitorDelegate <NSObject>
+
+//! Called once per broadcast when the upload falls more than backlogThreshold seconds behind the recording.
+- (void)uplinkMonitorDidDetectBacklog:(DVGUplinkMonitor *)monitor;
+
+@end
+
+/**
+ Estimates uplink throughput and upload backlog of the current broadcast from NHSBroadcastManager currentStreamBytesSent as published by the progress bus.
+ Samples can also be fed manually with addSampleWithBytesSent:atTime: which makes it possible to replay recorded traces without a progress bus.
+ */
+@interface DVGUplinkMonitor : NSObject
+
+@property (nonatomic, weak) id<DVGUplinkMonitorDelegate> delegate;
+
+//! Seconds of not uploaded video which are treated as a backlog. Defaults to three segments.
+@property (nonatomic, assign) NSTimeInterval backlogThreshold;
+
+//! Smoothed upload throughput in kbps.
+@property (nonatomic, readonly) double throughput;
+
+//! Estimated duration of recorded but not uploaded video.
+@property (nonatomic, readonly) NSTimeInterval backlogDuration;
+
+@property (nonatomic, readonly, getter=isFallingBehind) BOOL fallingBehind;
+
+//! Whether the upload fell behind at some point of the current broadcast. Otherwise throughput was limited by the recording, not by the network.
+@property (nonatomic, readonly) BOOL detectedBacklog;
+
+- (instancetype)initWithProgressBus:(DVGUploadProgressBus *)progressBus;
+
+/**
+ Starts sampling for a broadcast recorded with the given preset.
+ @param recordingStartTime When recording started, in the progress bus clock (NSDate timeIntervalSinceReferenceDate). Video recorded while the stream was being created counts towards the backlog. Negative to count from the first sample.
+ */
+- (void)startWithQualityPreset:(NHSStreamingQualityPreset)preset recordingStartTime:(NSTimeInterval)recordingStartTime;
+
+//! Recording has stopped, so no more video is added to the backlog.
+- (void)recordingDidStop;
+
+- (void)stop;
+
+- (void)addSampleWithBytesSent:(int64_t)bytesSent atTime:(NSTimeInterval)time;
+
+@end
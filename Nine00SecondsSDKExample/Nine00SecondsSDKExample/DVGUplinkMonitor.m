@@ -0,0 +1,128 @@
+//
+//  DVGUplinkMonitor.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGUplinkMonitor.h"
+#import "DVGQualityPresetUtilities.h"
+#import "DVGUploadProgressBus.h"
+
+static NSTimeInterval const kDVGUplinkMonitorMinimumSampleInterval = 1.0;
+static double const kDVGUplinkMonitorSmoothingFactor = 0.2;
+
+@interface DVGUplinkMonitor ()
+@property (nonatomic, strong) DVGUploadProgressBus *progressBus;
+@property (nonatomic, strong) id progressSubscriber;
+
+@property (nonatomic, assign) NHSStreamingQualityPreset qualityPreset;
+@property (nonatomic, assign) NSTimeInterval startTime;
+@property (nonatomic, assign) NSTimeInterval recordingStopTime;
+@property (nonatomic, assign) NSTimeInterval lastSampleTime;
+@property (nonatomic, assign) int64_t lastBytesSent;
+
+@property (nonatomic, readwrite) double throughput;
+@property (nonatomic, readwrite) NSTimeInterval backlogDuration;
+@property (nonatomic, readwrite) BOOL detectedBacklog;
+@end
+
+@implementation DVGUplinkMonitor
+
+- (instancetype)init {
+    return [self initWithProgressBus:nil];
+}
+
+- (instancetype)initWithProgressBus:(DVGUploadProgressBus *)progressBus {
+    self = [super init];
+    if (self) {
+        _progressBus = progressBus;
+        _backlogThreshold = 3 * kDVGSegmentDuration;
+        _startTime = -1;
+        _recordingStopTime = -1;
+        _lastSampleTime = -1;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [_progressBus removeSubscriber:_progressSubscriber];
+}
+
+- (void)startWithQualityPreset:(NHSStreamingQualityPreset)preset recordingStartTime:(NSTimeInterval)recordingStartTime {
+    [self stop];
+
+    self.qualityPreset = preset;
+    self.startTime = recordingStartTime;
+    self.throughput = 0;
+    self.backlogDuration = 0;
+    self.detectedBacklog = NO;
+
+    @weakify(self);
+    self.progressSubscriber = [self.progressBus addSubscriberWithBlock:^(int64_t bytesSent, NSTimeInterval time) {
+        @strongify(self);
+        [self addSampleWithBytesSent:bytesSent atTime:time];
+    }];
+}
+
+- (void)recordingDidStop {
+    if (self.recordingStopTime >= 0) return;
+
+    if (self.lastSampleTime < 0) {
+        // No sample yet, use the same clock as the progress bus.
+        self.recordingStopTime = [NSDate timeIntervalSinceReferenceDate];
+    }
+    else {
+        self.recordingStopTime = self.lastSampleTime;
+    }
+}
+
+- (void)stop {
+    [self.progressBus removeSubscriber:self.progressSubscriber];
+    self.progressSubscriber = nil;
+
+    self.startTime = -1;
+    self.recordingStopTime = -1;
+    self.lastSampleTime = -1;
+}
+
+- (BOOL)isFallingBehind {
+    return self.backlogDuration > self.backlogThreshold;
+}
+
+#pragma mark - Sampling
+
+- (void)addSampleWithBytesSent:(int64_t)bytesSent atTime:(NSTimeInterval)time {
+    if (self.lastSampleTime < 0) {
+        if (self.startTime < 0) {
+            self.startTime = time;
+        }
+        self.lastSampleTime = time;
+        self.lastBytesSent = bytesSent;
+        return;
+    }
+
+    NSTimeInterval interval = time - self.lastSampleTime;
+    if (interval < kDVGUplinkMonitorMinimumSampleInterval) {
+        return;
+    }
+
+    double kbps = (bytesSent - self.lastBytesSent) * 8.0 / 1000.0 / interval;
+    self.throughput = (self.throughput == 0 ? kbps :
+                       self.throughput + kDVGUplinkMonitorSmoothingFactor * (kbps - self.throughput));
+    self.lastSampleTime = time;
+    self.lastBytesSent = bytesSent;
+
+    NSTimeInterval recordedDuration = (self.recordingStopTime < 0 ? time : self.recordingStopTime) - self.startTime;
+    double uploadedDuration = bytesSent * 8.0 / 1000.0 / DVGBitrateForQualityPreset(self.qualityPreset);
+    self.backlogDuration = MAX(0, recordedDuration - uploadedDuration);
+
+    if (self.fallingBehind && !self.detectedBacklog) {
+        self.detectedBacklog = YES;
+        [self.delegate uplinkMonitorDidDetectBacklog:self];
+    }
+}
+
+@end
@@ -0,0 +1,70 @@
+//
+//  DVGUploadPolicy.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "AFNetworkReachabilityManager.h"
+#import "Nine00SecondsSDK.h"
+
+@interface DVGUploadPolicyDecision : NSObject
+
+//! Whether the saved upload queue may run.
+@property (nonatomic, assign) BOOL uploadAllowed;
+@property (nonatomic, assign) NHSStreamingQualityPreset maximumQualityPreset;
+
+@end
+
+/**
+ Single place that decides when the saved upload queue is resumed and which quality preset broadcasts may use.
+ The decision is made from reachability status, cellular rules and measured uplink throughput. Resumes after connectivity changes are debounced so flapping networks don't restart the queue over and over.
+ */
+@interface DVGUploadPolicy : NSObject
+
++ (instancetype)sharedPolicy;
+
+//! Reachability manager should be owned by the policy, its status change block is replaced.
+- (instancetype)initWithBroadcastManager:(NHSBroadcastManager *)broadcastManager
+                     reachabilityManager:(AFNetworkReachabilityManager *)reachabilityManager;
+
+//! Preset chosen by the user. Broadcast manager gets this preset limited by the current decision.
+@property (nonatomic, assign) NHSStreamingQualityPreset preferredQualityPreset;
+
+//! Upper limit the device can sustain, set by DVGPerformanceGovernor. Defaults to NHSStreamingQualityPreset1280HighBitrate.
+@property (nonatomic, assign) NHSStreamingQualityPreset sustainableQualityPreset;
+
+//! Whether the saved upload queue may be resumed on cellular. Live broadcast uploads are not affected. Defaults to YES.
+@property (nonatomic, assign) BOOL allowsCellularUploads;
+
+//! How long connectivity has to stay unchanged before the upload queue is resumed. Defaults to 3 seconds.
+@property (nonatomic, assign) NSTimeInterval resumeDelay;
+
+@property (nonatomic, readonly) AFNetworkReachabilityStatus reachabilityStatus;
+@property (nonatomic, readonly) double throughput;
+@property (nonatomic, readonly, getter=isBroadcasting) BOOL broadcasting;
+@property (nonatomic, strong, readonly) DVGUploadPolicyDecision *currentDecision;
+//! Whether the upload queue is going to be resumed after resumeDelay.
+@property (nonatomic, readonly, getter=isResumeScheduled) BOOL resumeScheduled;
+
+- (void)startMonitoring;
+- (void)stopMonitoring;
+
+- (void)reachabilityStatusDidChange:(AFNetworkReachabilityStatus)status;
+
+//! Measured uplink throughput in kbps, 0 if unknown.
+- (void)throughputDidChange:(double)throughput;
+
+//! Live broadcast has priority over the saved upload queue, which is held back until broadcast ends. The queue is resumed during a broadcast only when the app becomes active again, because the upload manager suspends the live upload with it.
+- (void)broadcastDidStart;
+- (void)broadcastDidStop;
+
+//! Pure decision function, result depends on arguments only.
++ (DVGUploadPolicyDecision *)decisionForReachabilityStatus:(AFNetworkReachabilityStatus)status
+                                                throughput:(double)throughput
+                                              broadcasting:(BOOL)broadcasting
+                                     allowsCellularUploads:(BOOL)allowsCellularUploads;
+
+@end
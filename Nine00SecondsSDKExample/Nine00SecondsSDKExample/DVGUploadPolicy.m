@@ -0,0 +1,238 @@
+//
+//  DVGUploadPolicy.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGUploadPolicy.h"
+#import "DVGQualityPresetUtilities.h"
+#import <netinet/in.h>
+@import UIKit;
+
+// Documented in NHSBroadcastManager qualityPreset.
+static NHSStreamingQualityPreset const kDVGUploadPolicyMaximumCellularPreset = NHSStreamingQualityPreset640;
+
+@implementation DVGUploadPolicyDecision
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; uploadAllowed = %d; maximumQualityPreset = %@>",
+            [self class], self, self.uploadAllowed, DVGQualityPresetDescription(self.maximumQualityPreset)];
+}
+
+@end
+
+@interface DVGUploadPolicy ()
+@property (nonatomic, strong) NHSBroadcastManager *broadcastManager;
+@property (nonatomic, strong) AFNetworkReachabilityManager *reachabilityManager;
+@property (nonatomic, readwrite) AFNetworkReachabilityStatus reachabilityStatus;
+@property (nonatomic, readwrite) double throughput;
+@property (nonatomic, readwrite) BOOL broadcasting;
+@property (nonatomic, strong, readwrite) DVGUploadPolicyDecision *currentDecision;
+@property (nonatomic, readwrite) BOOL resumeScheduled;
+//! Live upload was suspended with the queue when the app resigned active and hasn't been resumed yet, its tail may still be uploading after the broadcast ends.
+@property (nonatomic, assign) BOOL needsLiveUploadResume;
+@end
+
+@implementation DVGUploadPolicy
+
++ (instancetype)sharedPolicy {
+    static DVGUploadPolicy *sharedPolicy;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // Own manager, the shared one is used by the SDK and stopping it or replacing its block would affect it.
+        struct sockaddr_in address;
+        bzero(&address, sizeof(address));
+        address.sin_len = sizeof(address);
+        address.sin_family = AF_INET;
+
+        sharedPolicy = [[self alloc] initWithBroadcastManager:[NHSBroadcastManager sharedManager]
+                                          reachabilityManager:[AFNetworkReachabilityManager managerForAddress:&address]];
+    });
+
+    return sharedPolicy;
+}
+
+- (instancetype)initWithBroadcastManager:(NHSBroadcastManager *)broadcastManager
+                     reachabilityManager:(AFNetworkReachabilityManager *)reachabilityManager {
+    self = [super init];
+    if (self) {
+        _broadcastManager = broadcastManager;
+        _reachabilityManager = reachabilityManager;
+        _preferredQualityPreset = broadcastManager.qualityPreset;
+        _sustainableQualityPreset = NHSStreamingQualityPreset1280HighBitrate;
+        _allowsCellularUploads = YES;
+        _resumeDelay = 3.0;
+        _reachabilityStatus = AFNetworkReachabilityStatusUnknown;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [NSObject cancelPreviousPerformRequestsWithTarget:self];
+}
+
+- (void)startMonitoring {
+    @weakify(self);
+    [self.reachabilityManager setReachabilityStatusChangeBlock:^(AFNetworkReachabilityStatus status) {
+        @strongify(self);
+        [self reachabilityStatusDidChange:status];
+    }];
+    [self.reachabilityManager startMonitoring];
+
+    // Upload manager suspends its queue when application resigns active and doesn't resume it by itself.
+    NSNotificationCenter *notificationCenter = [NSNotificationCenter defaultCenter];
+    [notificationCenter addObserver:self selector:@selector(applicationDidBecomeActive:) name:UIApplicationDidBecomeActiveNotification object:nil];
+    [notificationCenter addObserver:self selector:@selector(applicationWillResignActive:) name:UIApplicationWillResignActiveNotification object:nil];
+}
+
+- (void)stopMonitoring {
+    [self.reachabilityManager stopMonitoring];
+    [self.reachabilityManager setReachabilityStatusChangeBlock:nil];
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [self scheduleResumeUploads:NO];
+}
+
+- (void)setPreferredQualityPreset:(NHSStreamingQualityPreset)preferredQualityPreset {
+    _preferredQualityPreset = preferredQualityPreset;
+    [self applyQualityPreset];
+}
+
+- (void)setSustainableQualityPreset:(NHSStreamingQualityPreset)sustainableQualityPreset {
+    _sustainableQualityPreset = sustainableQualityPreset;
+    [self applyQualityPreset];
+}
+
+- (void)setAllowsCellularUploads:(BOOL)allowsCellularUploads {
+    _allowsCellularUploads = allowsCellularUploads;
+    [self updateDecision];
+    [self setNeedsResumeUploads];
+}
+
+#pragma mark - Inputs
+
+- (void)reachabilityStatusDidChange:(AFNetworkReachabilityStatus)status {
+    if (status == self.reachabilityStatus) return;
+
+    DVGLog(@"Reachability changed %ld -> %ld", (long)self.reachabilityStatus, (long)status);
+    // Throughput measured on a previous network says nothing about the new one.
+    self.throughput = 0;
+    self.reachabilityStatus = status;
+    [self updateDecision];
+    [self setNeedsResumeUploads];
+}
+
+- (void)throughputDidChange:(double)throughput {
+    self.throughput = throughput;
+    [self updateDecision];
+}
+
+- (void)broadcastDidStart {
+    self.broadcasting = YES;
+    [self updateDecision];
+    [self setNeedsResumeUploads];
+}
+
+- (void)broadcastDidStop {
+    self.broadcasting = NO;
+    [self updateDecision];
+    [self setNeedsResumeUploads];
+}
+
+- (void)applicationDidBecomeActive:(NSNotification *)notification {
+    // Live upload runs in the same queue, which the upload manager suspends when the app resigns active.
+    // It has to be resumed even though saved uploads are held back, or the broadcast never finishes uploading.
+    if (self.broadcasting) {
+        self.needsLiveUploadResume = YES;
+    }
+    [self setNeedsResumeUploads];
+}
+
+- (void)applicationWillResignActive:(NSNotification *)notification {
+    [self scheduleResumeUploads:NO];
+}
+
+#pragma mark - Decision
+
++ (DVGUploadPolicyDecision *)decisionForReachabilityStatus:(AFNetworkReachabilityStatus)status
+                                                throughput:(double)throughput
+                                              broadcasting:(BOOL)broadcasting
+                                     allowsCellularUploads:(BOOL)allowsCellularUploads {
+    DVGUploadPolicyDecision *decision = [[DVGUploadPolicyDecision alloc] init];
+    decision.maximumQualityPreset = NHSStreamingQualityPreset1280HighBitrate;
+
+    switch (status) {
+        case AFNetworkReachabilityStatusReachableViaWiFi:
+            decision.uploadAllowed = YES;
+            break;
+
+        case AFNetworkReachabilityStatusReachableViaWWAN:
+            decision.uploadAllowed = allowsCellularUploads;
+            decision.maximumQualityPreset = kDVGUploadPolicyMaximumCellularPreset;
+            break;
+
+        case AFNetworkReachabilityStatusNotReachable:
+        case AFNetworkReachabilityStatusUnknown:
+            decision.uploadAllowed = NO;
+            break;
+    }
+
+    if (broadcasting) {
+        decision.uploadAllowed = NO;
+    }
+
+    if (throughput > 0) {
+        NHSStreamingQualityPreset throughputPreset = DVGHighestQualityPresetForBitrate(throughput * kDVGUsableThroughputRatio);
+        decision.maximumQualityPreset = MIN(decision.maximumQualityPreset, throughputPreset);
+    }
+
+    return decision;
+}
+
+- (void)updateDecision {
+    self.currentDecision = [[self class] decisionForReachabilityStatus:self.reachabilityStatus
+                                                              throughput:self.throughput
+                                                            broadcasting:self.broadcasting
+                                                   allowsCellularUploads:self.allowsCellularUploads];
+    [self applyQualityPreset];
+}
+
+- (void)setNeedsResumeUploads {
+    BOOL reachable = (self.reachabilityStatus == AFNetworkReachabilityStatusReachableViaWiFi ||
+                      self.reachabilityStatus == AFNetworkReachabilityStatusReachableViaWWAN);
+    [self scheduleResumeUploads:(self.currentDecision.uploadAllowed || (self.needsLiveUploadResume && reachable))];
+}
+
+- (void)scheduleResumeUploads:(BOOL)schedule {
+    // Every connectivity change restarts the countdown, so the queue is resumed once the network has settled.
+    [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(resumeUploads) object:nil];
+
+    self.resumeScheduled = schedule;
+    if (schedule) {
+        [self performSelector:@selector(resumeUploads) withObject:nil afterDelay:self.resumeDelay];
+    }
+}
+
+- (void)applyQualityPreset {
+    NHSStreamingQualityPreset preset = MIN(self.preferredQualityPreset, self.sustainableQualityPreset);
+    if (self.currentDecision) {
+        preset = MIN(preset, self.currentDecision.maximumQualityPreset);
+    }
+
+    if (self.broadcastManager.qualityPreset != preset) {
+        DVGLog(@"Quality preset %@", DVGQualityPresetDescription(preset));
+        self.broadcastManager.qualityPreset = preset;
+    }
+}
+
+- (void)resumeUploads {
+    self.resumeScheduled = NO;
+    self.needsLiveUploadResume = NO;
+    DVGLog(@"Resuming saved uploads");
+    [self.broadcastManager scheduleSavedUploads];
+}
+
+@end
@@ -0,0 +1,35 @@
+//
+//  DVGUploadProgressBus.h
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "Nine00SecondsSDK.h"
+
+typedef void (^DVGUploadProgressBlock)(int64_t bytesSent, NSTimeInterval time);
+
+/**
+ Reads currentStreamBytesSent of the broadcast manager at a bounded rate and publishes it to all subscribers on the main queue.
+ Polling runs only while there are subscribers. Subscribers are called when the value has changed and at least once a second otherwise, tick subscribers on every poll.
+ */
+@interface DVGUploadProgressBus : NSObject
+
++ (instancetype)sharedBus;
+
+- (instancetype)initWithBroadcastManager:(NHSBroadcastManager *)broadcastManager;
+
+//! Defaults to 0.1 s.
+@property (nonatomic, assign) NSTimeInterval publishInterval;
+
+@property (nonatomic, readonly) int64_t bytesSent;
+
+//! Returns an opaque token to pass to removeSubscriber:.
+- (id)addSubscriberWithBlock:(DVGUploadProgressBlock)block;
+//! Called every publishInterval whether or not the value has changed, for UI that shows elapsed time along with the progress.
+- (id)addTickSubscriberWithBlock:(DVGUploadProgressBlock)block;
+- (void)removeSubscriber:(id)subscriber;
+
+@end
@@ -0,0 +1,110 @@
+//
+//  DVGUploadProgressBus.m
+//  Nine00SecondsSDKExample
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import "DVGUploadProgressBus.h"
+
+// Unchanged value is republished this often so subscribers can notice a stalled upload.
+static NSTimeInterval const kDVGUploadProgressBusHeartbeatInterval = 1.0;
+
+@interface DVGUploadProgressBus ()
+@property (nonatomic, strong) NHSBroadcastManager *broadcastManager;
+@property (nonatomic, strong) NSMutableArray *subscribers;
+@property (nonatomic, strong) NSMutableArray *tickSubscribers;
+@property (nonatomic, strong) NSTimer *publishTimer;
+@property (nonatomic, readwrite) int64_t bytesSent;
+@property (nonatomic, assign) NSTimeInterval lastPublishTime;
+@end
+
+@implementation DVGUploadProgressBus
+
++ (instancetype)sharedBus {
+    static DVGUploadProgressBus *sharedBus;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedBus = [[self alloc] initWithBroadcastManager:[NHSBroadcastManager sharedManager]];
+    });
+
+    return sharedBus;
+}
+
+- (instancetype)initWithBroadcastManager:(NHSBroadcastManager *)broadcastManager {
+    self = [super init];
+    if (self) {
+        _broadcastManager = broadcastManager;
+        _subscribers = [NSMutableArray array];
+        _tickSubscribers = [NSMutableArray array];
+        _publishInterval = 0.1;
+        _bytesSent = -1;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [_publishTimer invalidate];
+}
+
+- (id)addSubscriberWithBlock:(DVGUploadProgressBlock)block {
+    return [self addSubscriberWithBlock:block toSubscribers:self.subscribers];
+}
+
+- (id)addTickSubscriberWithBlock:(DVGUploadProgressBlock)block {
+    return [self addSubscriberWithBlock:block toSubscribers:self.tickSubscribers];
+}
+
+- (id)addSubscriberWithBlock:(DVGUploadProgressBlock)block toSubscribers:(NSMutableArray *)subscribers {
+    NSParameterAssert([NSThread isMainThread]);
+
+    DVGUploadProgressBlock subscriber = [block copy];
+    [subscribers addObject:subscriber];
+
+    if (!self.publishTimer) {
+        self.publishTimer = [NSTimer timerWithTimeInterval:self.publishInterval target:self selector:@selector(publishTimerAction) userInfo:nil repeats:YES];
+        [[NSRunLoop mainRunLoop] addTimer:self.publishTimer forMode:NSRunLoopCommonModes];
+    }
+
+    // New subscriber gets the current value right away.
+    if (self.bytesSent >= 0) {
+        subscriber(self.bytesSent, [NSDate timeIntervalSinceReferenceDate]);
+    }
+
+    return subscriber;
+}
+
+- (void)removeSubscriber:(id)subscriber {
+    NSParameterAssert([NSThread isMainThread]);
+    if (!subscriber) return;
+
+    [self.subscribers removeObjectIdenticalTo:subscriber];
+    [self.tickSubscribers removeObjectIdenticalTo:subscriber];
+
+    if (self.subscribers.count == 0 && self.tickSubscribers.count == 0) {
+        [self.publishTimer invalidate];
+        self.publishTimer = nil;
+        self.bytesSent = -1;
+    }
+}
+
+- (void)publishTimerAction {
+    int64_t bytesSent = self.broadcastManager.currentStreamBytesSent;
+    NSTimeInterval time = [NSDate timeIntervalSinceReferenceDate];
+
+    for (DVGUploadProgressBlock subscriber in [self.tickSubscribers copy]) {
+        subscriber(bytesSent, time);
+    }
+
+    if (bytesSent == self.bytesSent && time - self.lastPublishTime < kDVGUploadProgressBusHeartbeatInterval) return;
+
+    self.bytesSent = bytesSent;
+    self.lastPublishTime = time;
+    for (DVGUploadProgressBlock subscriber in [self.subscribers copy]) {
+        subscriber(bytesSent, time);
+    }
+}
+
+@end
@@ -0,0 +1,79 @@
+//
+//  DVGCompressingLogFileManagerTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGCompressingLogFileManager.h"
+
+@interface DVGCompressingLogFileManagerTests : XCTestCase
+@property (nonatomic, copy) NSString *logsDirectory;
+@property (nonatomic, strong) DVGCompressingLogFileManager *logFileManager;
+@property (nonatomic, strong) NSData *logData;
+@end
+
+@implementation DVGCompressingLogFileManagerTests
+
+- (void)setUp {
+    [super setUp];
+
+    self.logsDirectory = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    self.logFileManager = [[DVGCompressingLogFileManager alloc] initWithLogsDirectory:self.logsDirectory];
+    self.logFileManager.maximumNumberOfLogFiles = 0;
+
+    // About 1 MB, the size at which the app rolls its log files.
+    NSMutableString *log = [NSMutableString string];
+    for (NSUInteger i = 0; log.length < 1024 * 1024; i++) {
+        [log appendFormat:@"2015-05-13 12:%02lu:%02lu.%03lu Upload progress %lu of 4194304 bytes, segment %lu\n",
+                          (unsigned long)(i / 60000 % 60), (unsigned long)(i / 1000 % 60), (unsigned long)(i % 1000),
+                          (unsigned long)(i * 512), (unsigned long)(i / 100)];
+    }
+    self.logData = [log dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:self.logsDirectory error:nil];
+
+    [super tearDown];
+}
+
+- (NSString *)createLogFile {
+    NSString *path = [self.logFileManager createNewLogFile];
+    [self.logData writeToFile:path atomically:NO];
+
+    return path;
+}
+
+- (void)testArchivedLogFileIsCompressed {
+    NSString *path = [self createLogFile];
+    [self.logFileManager didArchiveLogFile:path];
+
+    // Manifest is read on the compression queue, after the compression has finished.
+    NSArray *manifest = [self.logFileManager manifest];
+    XCTAssertEqual(manifest.count, 1);
+
+    NSDictionary *entry = manifest.firstObject;
+    XCTAssertEqualObjects(entry[DVGLogManifestUncompressedSizeKey], @(self.logData.length));
+    XCTAssertLessThan([entry[DVGLogManifestCompressedSizeKey] unsignedLongLongValue], self.logData.length / 4);
+    XCTAssertEqualObjects(entry[DVGLogManifestUploadedKey], @NO);
+
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    XCTAssertFalse([fileManager fileExistsAtPath:path]);
+    XCTAssertTrue([fileManager fileExistsAtPath:[self.logsDirectory stringByAppendingPathComponent:entry[DVGLogManifestFileNameKey]]]);
+
+    // Compressed file is still managed by the disk quota rules.
+    XCTAssertEqualObjects([self.logFileManager sortedLogFileNames], @[ entry[DVGLogManifestFileNameKey] ]);
+}
+
+- (void)testCompressionPerformance {
+    [self measureBlock:^{
+        [self.logFileManager didArchiveLogFile:[self createLogFile]];
+        [self.logFileManager manifest];
+    }];
+}
+
+@end
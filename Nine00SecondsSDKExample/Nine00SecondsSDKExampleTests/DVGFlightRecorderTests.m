@@ -0,0 +1,121 @@
+//
+//  DVGFlightRecorderTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGFlightRecorder.h"
+
+@interface DVGFlightRecorderTests : XCTestCase
+@property (nonatomic, copy) NSString *path;
+@end
+
+@implementation DVGFlightRecorderTests
+
+- (void)setUp {
+    [super setUp];
+
+    self.path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:self.path error:nil];
+
+    [super tearDown];
+}
+
+- (void)recordMessage:(NSString *)message inRecorder:(DVGFlightRecorder *)recorder {
+    const char *utf8 = [message UTF8String];
+    [recorder recordMessage:utf8 length:strlen(utf8) level:LOG_FLAG_INFO];
+}
+
+- (void)testRecordsAreDecodedInOrder {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:8];
+    [self recordMessage:@"first" inRecorder:recorder];
+    [self recordMessage:@"second" inRecorder:recorder];
+
+    NSArray *records = [recorder decodedRecords];
+    XCTAssertEqual(records.count, 2);
+    XCTAssertTrue([records[0] hasSuffix:@" first"]);
+    XCTAssertTrue([records[1] hasSuffix:@" second"]);
+}
+
+- (void)testRingKeepsMostRecentRecords {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:4];
+    for (NSUInteger i = 0; i < 6; i++) {
+        [self recordMessage:[NSString stringWithFormat:@"record %lu", (unsigned long)i] inRecorder:recorder];
+    }
+
+    NSArray *records = [recorder decodedRecords];
+    XCTAssertEqual(records.count, 4);
+    XCTAssertTrue([records.firstObject hasSuffix:@" record 2"]);
+    XCTAssertTrue([records.lastObject hasSuffix:@" record 5"]);
+}
+
+- (void)testRecordsSurviveReopening {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:8];
+    [self recordMessage:@"before crash" inRecorder:recorder];
+    recorder = nil;
+
+    DVGFlightRecorder *reopenedRecorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:8];
+    XCTAssertEqual([reopenedRecorder decodedRecords].count, 1);
+
+    [reopenedRecorder reset];
+    XCTAssertEqual([reopenedRecorder decodedRecords].count, 0);
+}
+
+- (void)testDifferentLayoutIsReset {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:8];
+    [self recordMessage:@"old layout" inRecorder:recorder];
+    recorder = nil;
+
+    DVGFlightRecorder *reopenedRecorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:16];
+    XCTAssertEqual([reopenedRecorder decodedRecords].count, 0);
+}
+
+- (void)testLongMessageIsTruncated {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:8];
+    NSString *message = [@"" stringByPaddingToLength:1000 withString:@"x" startingAtIndex:0];
+    [self recordMessage:message inRecorder:recorder];
+
+    NSString *record = [recorder decodedRecords].firstObject;
+    XCTAssertTrue([record hasSuffix:[message substringToIndex:232]]);
+    XCTAssertFalse([record hasSuffix:[message substringToIndex:233]]);
+}
+
+- (void)testLoggerForwardsAllButDVGLogMessages {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:8];
+    DVGFlightRecorderLogger *logger = [[DVGFlightRecorderLogger alloc] initWithRecorder:recorder];
+
+    DDLogMessage *message = [[DDLogMessage alloc] initWithLogMsg:@"from SDK" level:LOG_LEVEL_INFO flag:LOG_FLAG_INFO context:0
+                                                             file:__FILE__ function:__FUNCTION__ line:__LINE__ tag:nil options:0];
+    [logger logMessage:message];
+
+    // Recorded synchronously by DVGLog already.
+    message = [[DDLogMessage alloc] initWithLogMsg:@"from app" level:LOG_LEVEL_INFO flag:LOG_FLAG_INFO context:DVGLogContext
+                                              file:__FILE__ function:__FUNCTION__ line:__LINE__ tag:nil options:0];
+    [logger logMessage:message];
+
+    NSArray *records = [recorder decodedRecords];
+    XCTAssertEqual(records.count, 1);
+    XCTAssertTrue([records.firstObject hasSuffix:@" from SDK"]);
+}
+
+//! Ring write only, without formatting the message or passing it to DDLog as DVGLog does. Compare against the recorded baseline, target is under 50 ns per record, 5 ms per iteration.
+- (void)testRingWritePerformance {
+    DVGFlightRecorder *recorder = [[DVGFlightRecorder alloc] initWithPath:self.path slotCount:1024];
+    const char *message = "Upload progress 1048576 of 4194304 bytes, segment 42";
+    size_t length = strlen(message);
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 100000; i++) {
+            [recorder recordMessage:message length:length level:LOG_FLAG_INFO];
+        }
+    }];
+}
+
+@end
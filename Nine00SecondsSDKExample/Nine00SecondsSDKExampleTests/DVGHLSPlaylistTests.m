@@ -0,0 +1,95 @@
+//
+//  DVGHLSPlaylistTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGHLSPlaylist.h"
+
+@interface DVGHLSPlaylistTests : XCTestCase
+
+@end
+
+@implementation DVGHLSPlaylistTests
+
+- (void)testMediaPlaylist {
+    NSString *string = @"#EXTM3U\r\n"
+                       @"#EXT-X-VERSION:3\r\n"
+                       @"#EXT-X-TARGETDURATION:4\r\n"
+                       @"#EXT-X-MEDIA-SEQUENCE:10\r\n"
+                       @"#EXTINF:4.000,\r\n"
+                       @"segment10.ts\r\n"
+                       @"#EXTINF:3.500,title\r\n"
+                       @"segment11.ts\r\n"
+                       @"\r\n"
+                       @"#EXTINF:2.5\r\n"
+                       @"  segment12.ts  \r\n"
+                       @"#EXT-X-ENDLIST\r\n";
+
+    NSError *error;
+    DVGHLSPlaylist *playlist = [DVGHLSPlaylist playlistWithString:string error:&error];
+    XCTAssertNotNil(playlist, @"%@", error);
+
+    XCTAssertEqual(playlist.targetDuration, 4.0);
+    XCTAssertEqual(playlist.mediaSequence, 10);
+    XCTAssertTrue(playlist.endList);
+    XCTAssertEqual(playlist.variantURIs.count, 0);
+
+    XCTAssertEqual(playlist.segments.count, 3);
+    DVGHLSSegment *segment = playlist.segments[1];
+    XCTAssertEqual(segment.sequenceNumber, 11);
+    XCTAssertEqual(segment.duration, 3.5);
+    XCTAssertEqualObjects(segment.URI, @"segment11.ts");
+    XCTAssertEqualObjects([playlist.segments[2] URI], @"segment12.ts");
+}
+
+- (void)testSegmentDurationStatistics {
+    NSString *string = @"#EXTM3U\n"
+                       @"#EXTINF:4,\ns0.ts\n"
+                       @"#EXTINF:2,\ns1.ts\n"
+                       @"#EXTINF:4,\ns2.ts\n"
+                       @"#EXTINF:2,\ns3.ts\n";
+
+    DVGHLSPlaylist *playlist = [DVGHLSPlaylist playlistWithString:string error:NULL];
+
+    XCTAssertEqual(playlist.totalDuration, 12.0);
+    XCTAssertEqual(playlist.meanSegmentDuration, 3.0);
+    XCTAssertEqual(playlist.maxSegmentDuration, 4.0);
+    XCTAssertEqual(playlist.segmentDurationVariance, 1.0);
+}
+
+- (void)testEmptyPlaylistStatistics {
+    DVGHLSPlaylist *playlist = [DVGHLSPlaylist playlistWithString:@"#EXTM3U\n" error:NULL];
+
+    XCTAssertNotNil(playlist);
+    XCTAssertFalse(playlist.endList);
+    XCTAssertEqual(playlist.meanSegmentDuration, 0.0);
+    XCTAssertEqual(playlist.segmentDurationVariance, 0.0);
+}
+
+- (void)testMasterPlaylist {
+    NSString *string = @"#EXTM3U\n"
+                       @"#EXT-X-STREAM-INF:BANDWIDTH=1280000,RESOLUTION=640x360\n"
+                       @"low/index.m3u8\n"
+                       @"#EXT-X-STREAM-INF:BANDWIDTH=2560000,RESOLUTION=1280x720\n"
+                       @"http://example.com/high/index.m3u8\n";
+
+    DVGHLSPlaylist *playlist = [DVGHLSPlaylist playlistWithString:string error:NULL];
+
+    XCTAssertEqual(playlist.segments.count, 0);
+    XCTAssertEqualObjects(playlist.variantURIs, (@[ @"low/index.m3u8", @"http://example.com/high/index.m3u8" ]));
+}
+
+- (void)testNotAPlaylist {
+    NSError *error;
+    DVGHLSPlaylist *playlist = [DVGHLSPlaylist playlistWithString:@"<html></html>" error:&error];
+
+    XCTAssertNil(playlist);
+    XCTAssertEqualObjects(error.domain, DVGHLSPlaylistErrorDomain);
+}
+
+@end
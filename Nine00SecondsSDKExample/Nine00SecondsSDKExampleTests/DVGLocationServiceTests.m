@@ -0,0 +1,117 @@
+//
+//  DVGLocationServiceTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGLocationService.h"
+
+@interface DVGLocationServiceTests : XCTestCase
+@property (nonatomic, strong) NSDate *startDate;
+@end
+
+@implementation DVGLocationServiceTests
+
+- (void)setUp {
+    [super setUp];
+    self.startDate = [NSDate dateWithTimeIntervalSinceReferenceDate:0];
+}
+
+- (CLLocation *)locationWithLatitude:(double)latitude longitude:(double)longitude time:(NSTimeInterval)time {
+    return [[CLLocation alloc] initWithCoordinate:CLLocationCoordinate2DMake(latitude, longitude)
+                                         altitude:0
+                               horizontalAccuracy:10
+                                 verticalAccuracy:10
+                                        timestamp:[self.startDate dateByAddingTimeInterval:time]];
+}
+
+- (void)testQuantizedCoordinateIsCloseCellCenter {
+    CLLocationCoordinate2D coordinate = CLLocationCoordinate2DMake(59.93863, 30.31413);
+    CLLocationCoordinate2D quantized = [DVGLocationService quantizedCoordinate:coordinate];
+
+    CLLocation *original = [[CLLocation alloc] initWithLatitude:coordinate.latitude longitude:coordinate.longitude];
+    CLLocation *center = [[CLLocation alloc] initWithLatitude:quantized.latitude longitude:quantized.longitude];
+    // Half of the cell diagonal, plus a margin for the spherical approximation.
+    XCTAssertLessThanOrEqual([original distanceFromLocation:center], kDVGLocationServiceQuantizationDistance * 0.75);
+
+    // Center stays in its own cell.
+    CLLocationCoordinate2D requantized = [DVGLocationService quantizedCoordinate:quantized];
+    XCTAssertEqualWithAccuracy(requantized.latitude, quantized.latitude, 1e-9);
+    XCTAssertEqualWithAccuracy(requantized.longitude, quantized.longitude, 1e-9);
+}
+
+- (void)testNearbyCoordinatesShareCell {
+    CLLocationCoordinate2D center = [DVGLocationService quantizedCoordinate:CLLocationCoordinate2DMake(59.93863, 30.31413)];
+    // About 20 m away.
+    CLLocationCoordinate2D nearby = CLLocationCoordinate2DMake(center.latitude + 0.0002, center.longitude);
+    XCTAssertTrue([DVGLocationService coordinate:center isInSameCellAsCoordinate:nearby]);
+
+    // One cell north.
+    CLLocationCoordinate2D north = CLLocationCoordinate2DMake(center.latitude + 100.0 / 111320.0, center.longitude);
+    XCTAssertFalse([DVGLocationService coordinate:center isInSameCellAsCoordinate:north]);
+}
+
+- (void)testLocationTrace {
+    DVGLocationService *service = [[DVGLocationService alloc] init];
+    CLLocationCoordinate2D center = [DVGLocationService quantizedCoordinate:CLLocationCoordinate2DMake(59.93863, 30.31413)];
+    double cellLatitude = 100.0 / 111320.0;
+
+    XCTAssertTrue([service processLocation:[self locationWithLatitude:center.latitude longitude:center.longitude time:0]]);
+
+    // Jitter within the cell.
+    XCTAssertFalse([service processLocation:[self locationWithLatitude:center.latitude + cellLatitude / 4 longitude:center.longitude time:60]]);
+
+    // Next cell, but too soon, is held back.
+    XCTAssertFalse([service processLocation:[self locationWithLatitude:center.latitude + cellLatitude longitude:center.longitude time:10]]);
+    XCTAssertEqualWithAccuracy(service.location.coordinate.latitude, center.latitude, 1e-9);
+    XCTAssertNotNil(service.pendingLocation);
+
+    // Back in the published cell, nothing to publish anymore.
+    XCTAssertFalse([service processLocation:[self locationWithLatitude:center.latitude longitude:center.longitude time:15]]);
+    XCTAssertNil(service.pendingLocation);
+
+    // One cell north is held back again although it measures slightly less than 100 m.
+    XCTAssertFalse([service processLocation:[self locationWithLatitude:center.latitude + cellLatitude longitude:center.longitude time:20]]);
+    XCTAssertEqualWithAccuracy(service.pendingLocation.coordinate.latitude, center.latitude + cellLatitude, 1e-9);
+
+    // A fix after the interval replaces it.
+    XCTAssertTrue([service processLocation:[self locationWithLatitude:center.latitude + 2 * cellLatitude longitude:center.longitude time:40]]);
+    XCTAssertEqualWithAccuracy(service.location.coordinate.latitude, center.latitude + 2 * cellLatitude, 1e-9);
+    XCTAssertNil(service.pendingLocation);
+
+    CLLocation *invalid = [[CLLocation alloc] initWithCoordinate:center altitude:0 horizontalAccuracy:-1 verticalAccuracy:-1
+                                                       timestamp:[self.startDate dateByAddingTimeInterval:600]];
+    XCTAssertFalse([service processLocation:invalid]);
+}
+
+- (void)testHeldBackLocationIsPublishedAfterInterval {
+    DVGLocationService *service = [[DVGLocationService alloc] init];
+    service.minimumUpdateInterval = 0.1;
+    CLLocationCoordinate2D center = [DVGLocationService quantizedCoordinate:CLLocationCoordinate2DMake(59.93863, 30.31413)];
+    double cellLatitude = 100.0 / 111320.0;
+
+    __block NSUInteger notificationCount = 0;
+    id observer = [[NSNotificationCenter defaultCenter] addObserverForName:DVGLocationServiceDidUpdateLocationNotification object:service queue:nil usingBlock:^(NSNotification *note) {
+        notificationCount++;
+    }];
+
+    XCTAssertTrue([service processLocation:[self locationWithLatitude:center.latitude longitude:center.longitude time:0]]);
+
+    // The user stops in the next cell, no more fixes arrive.
+    XCTAssertFalse([service processLocation:[self locationWithLatitude:center.latitude + cellLatitude longitude:center.longitude time:0.05]]);
+    XCTAssertEqual(notificationCount, 1);
+
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.3]];
+
+    XCTAssertEqual(notificationCount, 2);
+    XCTAssertNil(service.pendingLocation);
+    XCTAssertEqualWithAccuracy(service.location.coordinate.latitude, center.latitude + cellLatitude, 1e-9);
+
+    [[NSNotificationCenter defaultCenter] removeObserver:observer];
+}
+
+@end
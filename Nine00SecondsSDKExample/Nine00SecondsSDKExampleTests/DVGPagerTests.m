@@ -0,0 +1,169 @@
+//
+//  DVGPagerTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGPager.h"
+
+@interface DVGPagerTests : XCTestCase <DVGPagerDelegate>
+@property (nonatomic, strong) DVGPager *pager;
+@property (nonatomic, strong) NSMutableArray *requestedDates;
+@property (nonatomic, strong) NSMutableArray *pendingCompletions;
+@property (nonatomic, assign) NSUInteger updateCount;
+@end
+
+@implementation DVGPagerTests
+
+- (void)setUp {
+    [super setUp];
+
+    self.requestedDates = [NSMutableArray array];
+    self.pendingCompletions = [NSMutableArray array];
+    self.updateCount = 0;
+
+    __weak DVGPagerTests *weakSelf = self;
+    self.pager = [[DVGPager alloc] initWithFetchBlock:^(NSDate *untilDate, DVGPagerFetchCompletion completion) {
+        [weakSelf.requestedDates addObject:untilDate ?: [NSNull null]];
+        [weakSelf.pendingCompletions addObject:[completion copy]];
+    } identifierKeyPath:@"streamID" dateKeyPath:@"createdAt"];
+    self.pager.pageSize = 3;
+    self.pager.prefetchDistance = 1;
+    self.pager.delegate = self;
+}
+
+- (void)pagerDidUpdateItems:(DVGPager *)pager {
+    self.updateCount++;
+}
+
+//! Items with IDs first..<first+count, each one a minute older than the previous.
+- (NSArray *)itemsFrom:(NSUInteger)first count:(NSUInteger)count {
+    NSMutableArray *items = [NSMutableArray array];
+    for (NSUInteger i = first; i < first + count; i++) {
+        [items addObject:@{ @"streamID" : [NSString stringWithFormat:@"%lu", (unsigned long)i],
+                            @"createdAt" : [NSDate dateWithTimeIntervalSinceReferenceDate:-60.0 * i] }];
+    }
+
+    return items;
+}
+
+- (void)respondWithItems:(NSArray *)items {
+    XCTAssertGreaterThan(self.pendingCompletions.count, 0);
+    DVGPagerFetchCompletion completion = self.pendingCompletions.firstObject;
+    [self.pendingCompletions removeObjectAtIndex:0];
+    completion(items, nil);
+}
+
+- (NSArray *)identifiers {
+    return [self.pager.items valueForKey:@"streamID"];
+}
+
+- (void)testPagesFollowCursorAndEndOnShortPage {
+    [self.pager reload];
+    XCTAssertEqualObjects(self.requestedDates.lastObject, [NSNull null]);
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+    XCTAssertTrue(self.pager.hasMoreItems);
+
+    [self.pager loadNextPage];
+    XCTAssertEqualObjects(self.requestedDates.lastObject, [self.pager.items.lastObject valueForKey:@"createdAt"]);
+
+    // Boundary item repeated by the backend is dropped.
+    [self respondWithItems:[self itemsFrom:2 count:2]];
+    XCTAssertEqualObjects([self identifiers], (@[ @"0", @"1", @"2", @"3" ]));
+    XCTAssertFalse(self.pager.hasMoreItems);
+
+    [self.pager loadNextPage];
+    XCTAssertEqual(self.requestedDates.count, 2);
+}
+
+- (void)testPrefetchNearEnd {
+    [self.pager reload];
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+
+    [self.pager itemWillBecomeVisibleAtIndex:0];
+    XCTAssertEqual(self.requestedDates.count, 1);
+
+    [self.pager itemWillBecomeVisibleAtIndex:2];
+    XCTAssertEqual(self.requestedDates.count, 2);
+    XCTAssertTrue(self.pager.loading);
+
+    // Only one request in flight.
+    [self.pager itemWillBecomeVisibleAtIndex:2];
+    XCTAssertEqual(self.requestedDates.count, 2);
+}
+
+- (void)testReloadKeepsItemsUntilResponse {
+    [self.pager reload];
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+
+    [self.pager reload];
+    XCTAssertEqual(self.pager.items.count, 3);
+
+    [self respondWithItems:[self itemsFrom:10 count:3]];
+    XCTAssertEqualObjects([self identifiers], (@[ @"10", @"11", @"12" ]));
+}
+
+- (void)testFailedReloadKeepsItems {
+    [self.pager reload];
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+
+    [self.pager reload];
+    DVGPagerFetchCompletion completion = self.pendingCompletions.lastObject;
+    completion(nil, [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]);
+
+    XCTAssertEqual(self.pager.items.count, 3);
+    XCTAssertFalse(self.pager.loading);
+}
+
+- (void)testStaleResponseIsIgnored {
+    [self.pager reload];
+    [self.pager reload];
+
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+    XCTAssertEqual(self.pager.items.count, 0);
+
+    [self respondWithItems:[self itemsFrom:5 count:3]];
+    XCTAssertEqualObjects([self identifiers], (@[ @"5", @"6", @"7" ]));
+}
+
+- (void)testTrimDropsItemsBelowVisibleAndRefetchesThem {
+    [self.pager reload];
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+    [self.pager loadNextPage];
+    [self respondWithItems:[self itemsFrom:3 count:3]];
+    [self.pager loadNextPage];
+    [self respondWithItems:[self itemsFrom:6 count:3]];
+
+    [self.pager itemWillBecomeVisibleAtIndex:1];
+    NSUInteger updateCount = self.updateCount;
+    [self.pager trimToVisibleItems];
+
+    // Visible items plus prefetch distance, but not less than a page.
+    XCTAssertEqualObjects([self identifiers], (@[ @"0", @"1", @"2" ]));
+    XCTAssertTrue(self.pager.hasMoreItems);
+    XCTAssertEqual(self.updateCount, updateCount + 1);
+
+    [self.pager loadNextPage];
+    XCTAssertEqualObjects(self.requestedDates.lastObject, [self itemsFrom:2 count:1].firstObject[@"createdAt"]);
+    [self respondWithItems:[self itemsFrom:3 count:3]];
+    XCTAssertEqual(self.pager.items.count, 6);
+}
+
+- (void)testRemoveItemAllowsItBack {
+    [self.pager reload];
+    [self respondWithItems:[self itemsFrom:0 count:3]];
+
+    [self.pager removeItemAtIndex:1];
+    XCTAssertEqualObjects([self identifiers], (@[ @"0", @"2" ]));
+
+    // Removed identifier is no longer treated as a duplicate.
+    [self.pager loadNextPage];
+    [self respondWithItems:[[self itemsFrom:1 count:1] arrayByAddingObjectsFromArray:[self itemsFrom:3 count:2]]];
+    XCTAssertEqualObjects([self identifiers], (@[ @"0", @"2", @"1", @"3", @"4" ]));
+}
+
+@end
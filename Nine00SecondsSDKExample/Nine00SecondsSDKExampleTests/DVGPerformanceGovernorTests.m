@@ -0,0 +1,114 @@
+//
+//  DVGPerformanceGovernorTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGPerformanceGovernor.h"
+
+@interface DVGPerformanceGovernorTests : XCTestCase
+@property (nonatomic, strong) DVGPerformanceGovernor *governor;
+@end
+
+@implementation DVGPerformanceGovernorTests
+
+- (void)setUp {
+    [super setUp];
+
+    self.governor = [[DVGPerformanceGovernor alloc] initWithUploadPolicy:nil];
+    self.governor.recoveryInterval = 120.0;
+}
+
+- (void)processSampleAtTime:(NSTimeInterval)timestamp thermalState:(DVGThermalState)thermalState batteryLevel:(float)batteryLevel charging:(BOOL)charging {
+    DVGPerformanceSample *sample = [[DVGPerformanceSample alloc] init];
+    sample.timestamp = timestamp;
+    sample.thermalState = thermalState;
+    sample.batteryLevel = batteryLevel;
+    sample.charging = charging;
+    [self.governor processSample:sample];
+}
+
+- (void)processSampleAtTime:(NSTimeInterval)timestamp thermalState:(DVGThermalState)thermalState {
+    [self processSampleAtTime:timestamp thermalState:thermalState batteryLevel:1.f charging:NO];
+}
+
+- (void)testNominalKeepsHighestPreset {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset1280HighBitrate);
+}
+
+- (void)testStepsDownAtOnce {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateSerious];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    [self processSampleAtTime:30 thermalState:DVGThermalStateCritical];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset480);
+
+    // Less pressure alone doesn't step up.
+    [self processSampleAtTime:60 thermalState:DVGThermalStateSerious];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset480);
+}
+
+- (void)testRecoversOneStepPerInterval {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateCritical];
+
+    [self processSampleAtTime:90 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset480);
+
+    [self processSampleAtTime:120 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    [self processSampleAtTime:150 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    [self processSampleAtTime:240 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640HighBitrate);
+}
+
+- (void)testFairHoldsRecovery {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateSerious];
+    [self processSampleAtTime:120 thermalState:DVGThermalStateFair];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    // Recovery interval restarts from the last fair sample.
+    [self processSampleAtTime:180 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    [self processSampleAtTime:240 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640HighBitrate);
+}
+
+- (void)testPressureDuringRecoveryRestartsInterval {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateSerious];
+    [self processSampleAtTime:100 thermalState:DVGThermalStateSerious];
+
+    [self processSampleAtTime:200 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    [self processSampleAtTime:220 thermalState:DVGThermalStateNominal];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640HighBitrate);
+}
+
+- (void)testBatteryLimits {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateNominal batteryLevel:0.05f charging:NO];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    // Low battery holds the preset.
+    [self processSampleAtTime:300 thermalState:DVGThermalStateNominal batteryLevel:0.15f charging:NO];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640);
+
+    // Charging device is not limited by its battery.
+    [self processSampleAtTime:420 thermalState:DVGThermalStateNominal batteryLevel:0.05f charging:YES];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset640HighBitrate);
+}
+
+- (void)testUnknownBatteryLevelIsIgnored {
+    [self processSampleAtTime:0 thermalState:DVGThermalStateNominal batteryLevel:-1.f charging:NO];
+    XCTAssertEqual(self.governor.sustainableQualityPreset, NHSStreamingQualityPreset1280HighBitrate);
+}
+
+@end
@@ -0,0 +1,115 @@
+//
+//  DVGUplinkMonitorTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGUplinkMonitor.h"
+
+// NHSStreamingQualityPreset640 is 664 kbps.
+static int64_t const kBytesPerSecondOfVideo = 664 * 1000 / 8;
+
+@interface DVGUplinkMonitorTests : XCTestCase <DVGUplinkMonitorDelegate>
+@property (nonatomic, strong) DVGUplinkMonitor *monitor;
+@property (nonatomic, assign) NSUInteger backlogNotificationCount;
+@end
+
+@implementation DVGUplinkMonitorTests
+
+- (void)setUp {
+    [super setUp];
+
+    self.monitor = [[DVGUplinkMonitor alloc] initWithProgressBus:nil];
+    self.monitor.delegate = self;
+    self.backlogNotificationCount = 0;
+}
+
+- (void)uplinkMonitorDidDetectBacklog:(DVGUplinkMonitor *)monitor {
+    self.backlogNotificationCount++;
+}
+
+//! One sample per second from..to, uploading the given share of the recorded bitrate since uploadStartTime.
+- (void)addSamplesFrom:(NSTimeInterval)from to:(NSTimeInterval)to uploadStartTime:(NSTimeInterval)uploadStartTime uploadRatio:(double)uploadRatio {
+    for (NSTimeInterval time = from; time <= to; time += 1.0) {
+        int64_t bytesSent = (int64_t)((time - uploadStartTime) * kBytesPerSecondOfVideo * uploadRatio);
+        [self.monitor addSampleWithBytesSent:bytesSent atTime:time];
+    }
+}
+
+- (void)testUploadKeepingUpHasNoBacklog {
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:0];
+    [self addSamplesFrom:0 to:120 uploadStartTime:0 uploadRatio:1.0];
+
+    XCTAssertEqualWithAccuracy(self.monitor.backlogDuration, 0, 0.01);
+    XCTAssertEqualWithAccuracy(self.monitor.throughput, 664, 1);
+    XCTAssertFalse(self.monitor.detectedBacklog);
+    XCTAssertEqual(self.backlogNotificationCount, 0);
+}
+
+- (void)testSlowUploadIsNotifiedOncePerBroadcast {
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:0];
+
+    // Half rate falls behind by t/2, the 24 s threshold is crossed after 48 s.
+    [self addSamplesFrom:0 to:48 uploadStartTime:0 uploadRatio:0.5];
+    XCTAssertFalse(self.monitor.fallingBehind);
+    XCTAssertEqual(self.backlogNotificationCount, 0);
+
+    [self addSamplesFrom:49 to:120 uploadStartTime:0 uploadRatio:0.5];
+    XCTAssertTrue(self.monitor.fallingBehind);
+    XCTAssertTrue(self.monitor.detectedBacklog);
+    XCTAssertEqualWithAccuracy(self.monitor.throughput, 332, 1);
+    XCTAssertEqual(self.backlogNotificationCount, 1);
+
+    // Next broadcast is notified again.
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:200];
+    XCTAssertFalse(self.monitor.detectedBacklog);
+    [self addSamplesFrom:200 to:300 uploadStartTime:200 uploadRatio:0.5];
+    XCTAssertEqual(self.backlogNotificationCount, 2);
+}
+
+- (void)testStreamCreationTimeCountsTowardsBacklog {
+    // Upload starts 30 s after recording, then keeps up.
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:0];
+    [self addSamplesFrom:30 to:40 uploadStartTime:30 uploadRatio:1.0];
+
+    XCTAssertEqualWithAccuracy(self.monitor.backlogDuration, 30, 0.01);
+    XCTAssertEqual(self.backlogNotificationCount, 1);
+
+    // Without the recording start time the clock starts at the first sample.
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:-1];
+    [self addSamplesFrom:30 to:40 uploadStartTime:30 uploadRatio:1.0];
+    XCTAssertEqualWithAccuracy(self.monitor.backlogDuration, 0, 0.01);
+}
+
+- (void)testRecordingStoppedBeforeFirstSample {
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:now - 10];
+    [self.monitor recordingDidStop];
+
+    // Ten seconds were recorded, the upload catches up with them and nothing is added afterwards.
+    [self.monitor addSampleWithBytesSent:0 atTime:now + 5];
+    [self.monitor addSampleWithBytesSent:5 * kBytesPerSecondOfVideo atTime:now + 10];
+    XCTAssertEqualWithAccuracy(self.monitor.backlogDuration, 5, 0.1);
+
+    [self.monitor addSampleWithBytesSent:10 * kBytesPerSecondOfVideo atTime:now + 60];
+    XCTAssertEqualWithAccuracy(self.monitor.backlogDuration, 0, 0.1);
+    XCTAssertEqual(self.backlogNotificationCount, 0);
+}
+
+- (void)testRecordingStopEndsBacklogGrowth {
+    [self.monitor startWithQualityPreset:NHSStreamingQualityPreset640 recordingStartTime:0];
+    [self addSamplesFrom:0 to:20 uploadStartTime:0 uploadRatio:0.5];
+    [self.monitor recordingDidStop];
+
+    [self addSamplesFrom:21 to:40 uploadStartTime:0 uploadRatio:0.5];
+
+    // 20 s recorded, 20 s uploaded at half rate by t = 40.
+    XCTAssertEqualWithAccuracy(self.monitor.backlogDuration, 0, 0.01);
+    XCTAssertEqual(self.backlogNotificationCount, 0);
+}
+
+@end
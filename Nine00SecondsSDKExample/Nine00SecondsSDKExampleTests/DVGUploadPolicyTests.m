@@ -0,0 +1,137 @@
+//
+//  DVGUploadPolicyTests.m
+//  Nine00SecondsSDKExampleTests
+//
+//  Created by agent on 18.10.26.
+//  Copyright (c) 2026 DENIVIP Group. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "DVGUploadPolicy.h"
+
+@interface DVGUploadPolicy (Notifications)
+- (void)applicationDidBecomeActive:(NSNotification *)notification;
+- (void)applicationWillResignActive:(NSNotification *)notification;
+@end
+
+@interface DVGUploadPolicyTests : XCTestCase
+
+@end
+
+@implementation DVGUploadPolicyTests
+
+- (DVGUploadPolicyDecision *)decisionForStatus:(AFNetworkReachabilityStatus)status throughput:(double)throughput broadcasting:(BOOL)broadcasting {
+    return [DVGUploadPolicy decisionForReachabilityStatus:status throughput:throughput broadcasting:broadcasting allowsCellularUploads:YES];
+}
+
+- (void)testWiFiAllowsUploadsAndAnyPreset {
+    DVGUploadPolicyDecision *decision = [self decisionForStatus:AFNetworkReachabilityStatusReachableViaWiFi throughput:0 broadcasting:NO];
+    XCTAssertTrue(decision.uploadAllowed);
+    XCTAssertEqual(decision.maximumQualityPreset, NHSStreamingQualityPreset1280HighBitrate);
+}
+
+- (void)testCellularCapsPreset {
+    DVGUploadPolicyDecision *decision = [self decisionForStatus:AFNetworkReachabilityStatusReachableViaWWAN throughput:0 broadcasting:NO];
+    XCTAssertTrue(decision.uploadAllowed);
+    XCTAssertEqual(decision.maximumQualityPreset, NHSStreamingQualityPreset640);
+}
+
+- (void)testCellularUploadsCanBeDisallowed {
+    DVGUploadPolicyDecision *decision = [DVGUploadPolicy decisionForReachabilityStatus:AFNetworkReachabilityStatusReachableViaWWAN
+                                                                            throughput:0
+                                                                          broadcasting:NO
+                                                                 allowsCellularUploads:NO];
+    XCTAssertFalse(decision.uploadAllowed);
+
+    decision = [DVGUploadPolicy decisionForReachabilityStatus:AFNetworkReachabilityStatusReachableViaWiFi
+                                                   throughput:0
+                                                 broadcasting:NO
+                                        allowsCellularUploads:NO];
+    XCTAssertTrue(decision.uploadAllowed);
+}
+
+- (void)testNoUploadsWithoutConnectivity {
+    XCTAssertFalse([self decisionForStatus:AFNetworkReachabilityStatusNotReachable throughput:0 broadcasting:NO].uploadAllowed);
+    XCTAssertFalse([self decisionForStatus:AFNetworkReachabilityStatusUnknown throughput:0 broadcasting:NO].uploadAllowed);
+}
+
+- (void)testSavedUploadsAreHeldBackWhileBroadcasting {
+    XCTAssertFalse([self decisionForStatus:AFNetworkReachabilityStatusReachableViaWiFi throughput:0 broadcasting:YES].uploadAllowed);
+}
+
+- (void)testThroughputCapsPreset {
+    // 80% of 1000 kbps fits 664 kbps of NHSStreamingQualityPreset640, but not 1296 kbps of the next one.
+    DVGUploadPolicyDecision *decision = [self decisionForStatus:AFNetworkReachabilityStatusReachableViaWiFi throughput:1000 broadcasting:NO];
+    XCTAssertEqual(decision.maximumQualityPreset, NHSStreamingQualityPreset640);
+
+    decision = [self decisionForStatus:AFNetworkReachabilityStatusReachableViaWWAN throughput:100000 broadcasting:NO];
+    XCTAssertEqual(decision.maximumQualityPreset, NHSStreamingQualityPreset640);
+}
+
+- (void)testConnectivityTrace {
+    DVGUploadPolicy *policy = [[DVGUploadPolicy alloc] initWithBroadcastManager:nil reachabilityManager:nil];
+
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusReachableViaWiFi];
+    [policy throughputDidChange:2000];
+    XCTAssertTrue(policy.currentDecision.uploadAllowed);
+    XCTAssertTrue(policy.resumeScheduled);
+    XCTAssertEqual(policy.currentDecision.maximumQualityPreset, NHSStreamingQualityPreset640HighBitrate);
+
+    // Saved uploads are held back while live.
+    [policy broadcastDidStart];
+    XCTAssertFalse(policy.currentDecision.uploadAllowed);
+    XCTAssertFalse(policy.resumeScheduled);
+
+    // Throughput of the previous network is forgotten.
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusReachableViaWWAN];
+    XCTAssertEqual(policy.throughput, 0);
+    XCTAssertEqual(policy.currentDecision.maximumQualityPreset, NHSStreamingQualityPreset640);
+    XCTAssertFalse(policy.resumeScheduled);
+
+    [policy broadcastDidStop];
+    XCTAssertTrue(policy.resumeScheduled);
+
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusNotReachable];
+    XCTAssertFalse(policy.currentDecision.uploadAllowed);
+    XCTAssertFalse(policy.resumeScheduled);
+
+    [policy stopMonitoring];
+}
+
+- (void)testLiveUploadIsResumedWhenAppBecomesActive {
+    DVGUploadPolicy *policy = [[DVGUploadPolicy alloc] initWithBroadcastManager:nil reachabilityManager:nil];
+    policy.allowsCellularUploads = NO;
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusReachableViaWWAN];
+    [policy broadcastDidStart];
+    XCTAssertFalse(policy.resumeScheduled);
+
+    [policy applicationWillResignActive:nil];
+    [policy applicationDidBecomeActive:nil];
+    XCTAssertTrue(policy.resumeScheduled);
+
+    // Pending live resume survives a flapping network.
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusNotReachable];
+    XCTAssertFalse(policy.resumeScheduled);
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusReachableViaWWAN];
+    XCTAssertTrue(policy.resumeScheduled);
+
+    // Rest of the live upload still needs the queue after the broadcast ends.
+    [policy broadcastDidStop];
+    XCTAssertTrue(policy.resumeScheduled);
+
+    [policy stopMonitoring];
+}
+
+- (void)testBecomingActiveWithoutBroadcastFollowsDecision {
+    DVGUploadPolicy *policy = [[DVGUploadPolicy alloc] initWithBroadcastManager:nil reachabilityManager:nil];
+    policy.allowsCellularUploads = NO;
+    [policy reachabilityStatusDidChange:AFNetworkReachabilityStatusReachableViaWWAN];
+
+    [policy applicationDidBecomeActive:nil];
+    XCTAssertFalse(policy.resumeScheduled);
+
+    [policy stopMonitoring];
+}
+
+@end